@@ -0,0 +1,136 @@
+// OD_find(): binary search of the entry list against the direct index (OD_lut_t: generated by od_gen in the driver OD,
+// co_od_lut_init() for the example OD). Lookups: the OD's own indices alternating with indices just above them
+// (present or not), in random order. Then 0x1016 consumer heartbeat times read and written through
+// OD_find() + OD_get_u32()/OD_set_u32() against handles resolved once (co_od_u32_t).
+// usage: program [lookups]
+#include "co_od.h"
+#include "timedate.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define LOOKUPS 20000000
+#define KEYS 4096 // power of two
+
+extern OD_t *OD_example, *OD_driver;
+
+static uint32_t seed = 1;
+
+// xorshift32, same key order on every run
+static uint32_t rnd(void)
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	return seed;
+}
+
+static double run(OD_t *od, const uint16_t *keys, uint32_t lookups, uintptr_t *sum)
+{
+	TD_V t0, t1;
+	uintptr_t s = 0;
+	TD_GET(t0);
+	for(uint32_t i = 0; i < lookups; i++) s += (uintptr_t)OD_find(od, keys[i & (KEYS - 1)]);
+	TD_GET(t1);
+	*sum = s;
+	return TD_CALC_s(t1, t0);
+}
+
+static int bench(const char *name, OD_t *od, uint32_t lookups)
+{
+	static uint16_t keys[KEYS];
+	for(uint32_t i = 0; i < KEYS; i++)
+	{
+		const uint16_t index = od->list[rnd() % od->size].index;
+		keys[i] = (i & 1) ? index : (uint16_t)(index + 1 + rnd() % 7); // odd: present, even: a neighbour, present or not
+	}
+
+	const OD_lut_t *generated = od->lut;
+	od->lut = NULL;
+	uint32_t found = 0;
+	for(uint32_t i = 0; i < KEYS; i++) found += OD_find(od, keys[i]) ? 1 : 0;
+
+	uintptr_t sum_search, sum_lut;
+	const double t_search = run(od, keys, lookups, &sum_search);
+	od->lut = generated;
+	if(co_od_lut_init(od))
+	{
+		printf("ERR %s: out of memory\n", name);
+		return -1;
+	}
+	size_t pages = 0;
+	for(uint32_t p = 0; p < 256; p++) pages += od->lut->page[p] ? 1 : 0;
+	const double t_lut = run(od, keys, lookups, &sum_lut);
+	if(!generated) co_od_lut_deinit(od);
+
+	printf("%s: %u entries, %zu pages, %s index %zu bytes, %u%% of the lookups hit\n", name, od->size, pages,
+		   generated ? "generated" : "runtime", sizeof(OD_lut_t) + pages * 256 * sizeof(uint16_t), found * 100 / KEYS);
+	printf("  search: %7.2f ns/lookup\n", t_search / lookups * 1e9);
+	printf("  lut:    %7.2f ns/lookup\n", t_lut / lookups * 1e9);
+	printf("  speedup: %.2fx\n", t_search / t_lut);
+	if(sum_search != sum_lut)
+	{
+		printf("ERR %s: lookups disagree\n", name);
+		return -1;
+	}
+	return 0;
+}
+
+#define HB_CONS 64 // handles, power of two
+
+static int bench_handles(const char *name, OD_t *od, uint32_t lookups)
+{
+	static co_od_u32_t h[HB_CONS];
+	for(uint8_t i = 0; i < HB_CONS; i++)
+		if(co_od_u32_init(&h[i], od, 0x1016, (uint8_t)(i + 1)) != ODR_OK)
+		{
+			printf("ERR %s: 0x1016sub%d not resolved\n", name, i + 1);
+			return -1;
+		}
+
+	TD_V t0, t1;
+	uint32_t sum_od = 0, sum_h = 0, v;
+	TD_GET(t0);
+	for(uint32_t i = 0; i < lookups; i++)
+	{
+		const uint8_t sub = (uint8_t)((i & (HB_CONS - 1)) + 1);
+		OD_entry_t *e = OD_find(od, 0x1016);
+		OD_get_u32(e, sub, &v, false);
+		OD_set_u32(e, sub, v + 1, false);
+		sum_od += v;
+	}
+	TD_GET(t1);
+	const double t_od = TD_CALC_s(t1, t0);
+	TD_GET(t0);
+	for(uint32_t i = 0; i < lookups; i++)
+	{
+		co_od_u32_t *hi = &h[i & (HB_CONS - 1)];
+		v = co_od_u32_get(hi);
+		co_od_u32_set(hi, v - 1); // undoes the first loop, same values read
+		sum_h += v - 1;
+	}
+	TD_GET(t1);
+	const double t_h = TD_CALC_s(t1, t0);
+
+	printf("%s: 0x1016 read + write\n", name);
+	printf("  OD_find + OD_get/set: %7.2f ns/access\n", t_od / lookups * 1e9);
+	printf("  handle:               %7.2f ns/access\n", t_h / lookups * 1e9);
+	printf("  speedup: %.2fx\n", t_od / t_h);
+	if(sum_od != sum_h)
+	{
+		printf("ERR %s: accesses disagree\n", name);
+		return -1;
+	}
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const uint32_t lookups = argc > 1 && atol(argv[1]) > 0 ? (uint32_t)atol(argv[1]) : LOOKUPS;
+	int ret = bench("example OD", OD_example, lookups);
+	if(!ret) ret = bench("driver OD", OD_driver, lookups);
+	if(!ret) ret = bench_handles("driver OD", OD_driver, lookups);
+	return ret;
+}
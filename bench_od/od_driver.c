@@ -0,0 +1,5 @@
+// canopennode_driver/OD.c under names of its own, next to canopennode/example/OD.c in one program
+#define OD OD_driver
+#define OD_PERSIST_COMM OD_PERSIST_COMM_driver
+#define OD_RAM OD_RAM_driver
+#include "../canopennode_driver/OD.c"
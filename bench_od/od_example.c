@@ -0,0 +1,5 @@
+// canopennode/example/OD.c under names of its own, next to canopennode_driver/OD.c in one program
+#define OD OD_example
+#define OD_PERSIST_COMM OD_PERSIST_COMM_example
+#define OD_RAM OD_RAM_example
+#include "../canopennode/example/OD.c"
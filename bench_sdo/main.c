@@ -0,0 +1,144 @@
+// SDO throughput: block against segmented transfer of one domain object
+// The SDO server is the stand-in slave from sdo_sim.h on the other side of a pty, it answers after rtt_us to model the
+// bus round trip.
+// Node BLK_NODE supports block transfer, SEG_NODE refuses it (abort 0x05040001) so the client falls back to segmented.
+// The block transfer is repeated through mmap'ed files to check the streaming path.
+// usage: program [size_bytes] [rtt_us]   (Linux only)
+#define _GNU_SOURCE
+#include "co_wrapper.h"
+#include "sdo.h"
+#include "sdo_file.h"
+#include "sdo_sim.h"
+#include "slcan.h"
+#include "timedate.h"
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define BLK_NODE 10
+#define SEG_NODE 11
+#define OBJ_INDEX 0x2000
+#define OBJ_SUB 0
+#define OBJ_MAX SDO_SIM_DOMAIN_MAX
+
+static sdo_sim_shared_t *srv;
+
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+
+static uint8_t data_wr[OBJ_MAX], data_rd[OBJ_MAX + 1]; // +1: file length check
+
+static void run(CO_t *co, const char *name, uint8_t node, size_t size)
+{
+	TD_V t0, t1;
+	for(size_t i = 0; i < size; i++)
+		data_wr[i] = (uint8_t)rand();
+
+	srv->frames_rx = srv->frames_tx = 0;
+	TD_GET(t0);
+	CO_SDO_abortCode_t sts = write_SDO(co->SDOclient, node, OBJ_INDEX, OBJ_SUB, data_wr, size, 1000);
+	TD_GET(t1);
+	bool ok = sts == CO_SDO_AB_NONE && srv->domain_size == size && !memcmp(srv->domain, data_wr, size);
+	double s = TD_CALC_s(t1, t0);
+	printf("%-10s download %8zu B  %8.1f ms  %8.1f kB/s  frames %6u/%-6u %s", name, size, s * 1e3, size / s / 1e3, srv->frames_rx, srv->frames_tx, ok ? "ok" : "FAIL");
+	if(sts) printf(" (abort 0x%08X)", sts);
+	printf("\n");
+
+	size_t rs = 0;
+	memset(data_rd, 0, size);
+	srv->frames_rx = srv->frames_tx = 0;
+	TD_GET(t0);
+	sts = read_SDO(co->SDOclient, node, OBJ_INDEX, OBJ_SUB, data_rd, size, &rs, 1000);
+	TD_GET(t1);
+	ok = sts == CO_SDO_AB_NONE && rs == size && !memcmp(data_rd, data_wr, size);
+	s = TD_CALC_s(t1, t0);
+	printf("%-10s upload   %8zu B  %8.1f ms  %8.1f kB/s  frames %6u/%-6u %s", name, size, s * 1e3, size / s / 1e3, srv->frames_rx, srv->frames_tx, ok ? "ok" : "FAIL");
+	if(sts) printf(" (abort 0x%08X)", sts);
+	printf("\n");
+}
+
+// Same transfer streamed through mmap'ed files (write_SDO_file/read_SDO_file)
+static void run_file(CO_t *co, const char *name, uint8_t node, size_t size)
+{
+	char src[] = "/tmp/bench_sdo_XXXXXX", dst[] = "/tmp/bench_sdo_XXXXXX";
+	int fd_src = mkstemp(src), fd_dst = mkstemp(dst);
+	if(fd_src < 0 || fd_dst < 0 || write(fd_src, data_wr, size) != (ssize_t)size)
+	{
+		perror("tmp file");
+		return;
+	}
+	close(fd_src);
+	close(fd_dst);
+
+	TD_V t0, t1;
+	srv->frames_rx = srv->frames_tx = 0;
+	TD_GET(t0);
+	CO_SDO_abortCode_t sts = write_SDO_file(co->SDOclient, node, OBJ_INDEX, OBJ_SUB, src, 1000);
+	TD_GET(t1);
+	bool ok = sts == CO_SDO_AB_NONE && srv->domain_size == size && !memcmp(srv->domain, data_wr, size);
+	double s = TD_CALC_s(t1, t0);
+	printf("%-10s download %8zu B  %8.1f ms  %8.1f kB/s  frames %6u/%-6u %s", name, size, s * 1e3, size / s / 1e3, srv->frames_rx, srv->frames_tx, ok ? "ok" : "FAIL");
+	if(sts) printf(" (abort 0x%08X)", sts);
+	printf("\n");
+
+	size_t rs = 0;
+	srv->frames_rx = srv->frames_tx = 0;
+	TD_GET(t0);
+	sts = read_SDO_file(co->SDOclient, node, OBJ_INDEX, OBJ_SUB, dst, &rs, 1000);
+	TD_GET(t1);
+	ok = false;
+	FILE *f = fopen(dst, "rb");
+	if(f)
+	{
+		ok = sts == CO_SDO_AB_NONE && rs == size && fread(data_rd, 1, size + 1, f) == size && !memcmp(data_rd, data_wr, size);
+		fclose(f);
+	}
+	s = TD_CALC_s(t1, t0);
+	printf("%-10s upload   %8zu B  %8.1f ms  %8.1f kB/s  frames %6u/%-6u %s", name, size, s * 1e3, size / s / 1e3, srv->frames_rx, srv->frames_tx, ok ? "ok" : "FAIL");
+	if(sts) printf(" (abort 0x%08X)", sts);
+	printf("\n");
+
+	unlink(src);
+	unlink(dst);
+}
+
+int main(int argc, char **argv)
+{
+	size_t size = argc > 1 ? (size_t)atol(argv[1]) : 16384;
+	const uint32_t rtt_us = argc > 2 ? (uint32_t)atol(argv[2]) : 500;
+	if(size == 0 || size > OBJ_MAX) size = OBJ_MAX;
+
+	char port[64];
+	const sdo_sim_cfg_t cfg = {.node_blk = BLK_NODE, .node_seg = SEG_NODE, .delay_us = rtt_us};
+	const pid_t sim = sdo_sim_start(&cfg, port, sizeof(port));
+	srv = sdo_sim_shared();
+	if(sim < 0)
+	{
+		perror("stand-in slave");
+		return 1;
+	}
+
+	CO_t *co = NULL;
+	sp_t sp = {0};
+	int sts = co_wrapper_init(&co, &sp, NULL);
+	if(!sts) sts = sp_open(&sp, port, sp_rx, co);
+	if(sts)
+	{
+		printf("init failed: %d\n", sts);
+		sdo_sim_stop(sim);
+		return 1;
+	}
+
+	printf("object 0x%04X:%d, %zu bytes, simulated rtt %u us, client blksize %d\n", OBJ_INDEX, OBJ_SUB, size, rtt_us, CO_CONFIG_SDO_CLI_BLKSIZE);
+	run(co, "block", BLK_NODE, size);
+	run(co, "segmented", SEG_NODE, size); // first transfer learns that the node refuses block mode
+	run_file(co, "block file", BLK_NODE, size);
+
+	sp_close(&sp);
+	co_wrapper_deinit(&co);
+	sdo_sim_stop(sim);
+	return 0;
+}
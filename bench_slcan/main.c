@@ -0,0 +1,223 @@
+// SLCAN rx parser throughput: slcan_parse() against the previous byte-by-byte parser
+// usage: program [recorded_slcan_stream_file]
+#include "CO_driver_target.h"
+#include "slcan.h"
+#include "timedate.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GEN_FRAMES 200000
+#define CHUNK 1024 // bytes delivered per read()
+#define REPEAT 20
+
+static struct
+{
+	uint32_t frames;
+	uint32_t sum;
+} stat;
+
+int CO_rx(void *priv, can_msg_t *msg)
+{
+	(void)priv;
+	stat.frames++;
+	stat.sum += msg->id.ext + msg->DLC + msg->data[0] + msg->data[msg->DLC ? msg->DLC - 1 : 0];
+	return 0;
+}
+
+void CO_CANmodule_wakeup(CO_CANmodule_t *CANmodule) { (void)CANmodule; }
+
+// ---- reference: parser as it was before the bulk rewrite ----
+static struct
+{
+	uint8_t buf[SLCAN_BUFFER_SIZE + 1];
+	int32_t pos;
+} ref;
+
+static uint8_t hex2nibble(char c, bool *e)
+{
+	if(c >= '0' && c <= '9')
+		return c - '0';
+	else if(c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	else if(c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	*e = true;
+	return 0;
+}
+
+static int ref_frm(const uint8_t *cmd, bool ext, bool rtr)
+{
+	can_msg_t msg = {.IDE = ext, .RTR = rtr};
+	bool e = false;
+	const uint32_t id_len = ext ? 8 : 3;
+	uint32_t id = 0;
+	for(uint32_t i = 1; i <= id_len; i++)
+		id = (id << 4) | hex2nibble(cmd[i], &e);
+	msg.id.ext = id;
+	if(cmd[1 + id_len] < '0' || cmd[1 + id_len] > '0' + 8) return -1;
+	msg.DLC = cmd[1 + id_len] - '0';
+	if(!rtr)
+	{
+		const uint8_t *p = &cmd[2 + id_len];
+		for(unsigned i = 0; i < msg.DLC; i++)
+		{
+			msg.data[i] = (hex2nibble(*p, &e) << 4) | hex2nibble(*(p + 1), &e);
+			p += 2;
+		}
+	}
+	if(e) return -3;
+	return CO_rx(NULL, &msg);
+}
+
+static int ref_process(const uint8_t *msg)
+{
+	switch(msg[0])
+	{
+	case 'T': return ref_frm(msg, true, false);
+	case 't': return ref_frm(msg, false, false);
+	case 'R': return ref_frm(msg, true, true);
+	case 'r': return msg[1] <= '9' ? ref_frm(msg, false, true) : -1;
+	default: return -1;
+	}
+}
+
+static void ref_parse(const uint8_t *msg, size_t len)
+{
+	for(size_t i = 0; i < len; i++)
+	{
+		if(msg[i] >= 32 && msg[i] <= 126)
+		{
+			if(ref.pos < SLCAN_BUFFER_SIZE)
+				ref.buf[ref.pos++] = msg[i];
+			else
+				ref.pos = 0;
+		}
+		else if(msg[i] == '\r')
+		{
+			ref.buf[ref.pos] = '\0';
+			ref_process(ref.buf);
+			ref.pos = 0;
+		}
+		else if(msg[i] == 8 || msg[i] == 127)
+		{
+			if(ref.pos > 0) ref.pos -= 1;
+		}
+		else
+		{
+			ref.pos = 0;
+		}
+	}
+}
+
+// ---- stream ----
+static uint8_t *stream_load(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	if(!f) return NULL;
+	fseek(f, 0, SEEK_END);
+	*len = (size_t)ftell(f);
+	fseek(f, 0, SEEK_SET);
+	uint8_t *s = malloc(*len);
+	if(s && fread(s, 1, *len, f) != *len)
+	{
+		free(s);
+		s = NULL;
+	}
+	fclose(f);
+	return s;
+}
+
+// Traffic mix of a small CANopen network: PDOs, SDOs, heartbeats, some extended and RTR frames
+static uint8_t *stream_generate(size_t *len)
+{
+	uint8_t *s = malloc((size_t)GEN_FRAMES * SLCAN_MAX_FRAME_SIZE);
+	if(!s) return NULL;
+	uint32_t seed = 1;
+	size_t n = 0;
+	for(uint32_t i = 0; i < GEN_FRAMES; i++)
+	{
+		seed = seed * 1103515245U + 12345U;
+		const uint32_t r = seed >> 8;
+		can_msg_t msg = {.ts = (uint16_t)(i % 60000)};
+		switch(r % 16)
+		{
+		case 0: msg.id.std = 0x700 + (r >> 4) % 127 + 1, msg.DLC = 1; break; // heartbeat
+		case 1: msg.IDE = 1, msg.id.ext = r & 0x1FFFFFFF, msg.DLC = (r >> 8) % 9; break;
+		case 2: msg.RTR = 1, msg.id.std = 0x180 + (r >> 4) % 127 + 1, msg.DLC = 8; break;
+		case 3:
+		case 4: msg.id.std = 0x580 + (r >> 4) % 127 + 1, msg.DLC = 8; break; // SDO
+		default: msg.id.std = 0x180 + ((r >> 4) % 4) * 0x100 + (r >> 8) % 127 + 1, msg.DLC = (r >> 12) % 9; break; // PDO
+		}
+		for(uint32_t b = 0; b < 8; b++)
+			msg.data[b] = (uint8_t)(r >> b);
+		n += (size_t)slcan_encode(&msg, &s[n]);
+	}
+	*len = n;
+	return s;
+}
+
+static double run_ref(const uint8_t *s, size_t len)
+{
+	TD_V t0, t1;
+	TD_GET(t0);
+	for(int r = 0; r < REPEAT; r++)
+	{
+		ref.pos = 0;
+		for(size_t off = 0; off < len; off += CHUNK)
+			ref_parse(&s[off], len - off < CHUNK ? len - off : CHUNK);
+	}
+	TD_GET(t1);
+	return TD_CALC_s(t1, t0);
+}
+
+// Like the mirrored rx ring: the unconsumed tail is handed again together with the next chunk, nothing is copied
+static double run_new(const uint8_t *s, size_t len)
+{
+	TD_V t0, t1;
+	TD_GET(t0);
+	for(int r = 0; r < REPEAT; r++)
+	{
+		size_t tail = 0;
+		for(size_t head = 0; head < len;)
+		{
+			head += len - head < CHUNK ? len - head : CHUNK;
+			tail += slcan_parse(NULL, &s[tail], head - tail);
+		}
+	}
+	TD_GET(t1);
+	return TD_CALC_s(t1, t0);
+}
+
+int main(int argc, char **argv)
+{
+	size_t len = 0;
+	uint8_t *s = argc > 1 ? stream_load(argv[1], &len) : stream_generate(&len);
+	if(!s)
+	{
+		printf("ERR: no stream\n");
+		return 1;
+	}
+
+	memset(&stat, 0, sizeof(stat));
+	double t_ref = run_ref(s, len);
+	const uint32_t ref_frames = stat.frames, ref_sum = stat.sum;
+
+	memset(&stat, 0, sizeof(stat));
+	double t_new = run_new(s, len);
+
+	printf("stream: %zu bytes, %u frames x %d\n", len, ref_frames / REPEAT, REPEAT);
+	printf("before: %10.0f frames/s %8.1f MB/s\n", ref_frames / t_ref, (double)len * REPEAT / t_ref / 1e6);
+	printf("after:  %10.0f frames/s %8.1f MB/s\n", stat.frames / t_new, (double)len * REPEAT / t_new / 1e6);
+	printf("speedup: %.2fx\n", t_ref / t_new);
+	if(stat.frames != ref_frames || stat.sum != ref_sum)
+	{
+		printf("ERR: parsers disagree (%u/%u frames)\n", stat.frames, ref_frames);
+		return 1;
+	}
+
+	free(s);
+	return 0;
+}
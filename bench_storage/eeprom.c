@@ -0,0 +1,63 @@
+#include "eeprom.h"
+#include "301/crc16-ccitt.h"
+#include "storage/CO_eeprom.h"
+#include <string.h>
+
+void eeprom_blank(eeprom_t *e)
+{
+	memset(e->mem, 0xFF, sizeof(e->mem));
+	e->rd = e->wr = 0;
+}
+
+bool_t CO_eeprom_init(void *storageModule)
+{
+	eeprom_t *e = storageModule;
+	e->next_prot = 0;
+	e->next_auto = EEPROM_SIZE / 2;
+	return true;
+}
+
+size_t CO_eeprom_getAddr(void *storageModule, bool_t isAuto, size_t len, bool_t *overflow)
+{
+	eeprom_t *e = storageModule;
+	size_t *next = isAuto ? &e->next_auto : &e->next_prot;
+	const size_t addr = *next;
+	*next += (len + EEPROM_PAGE - 1) / EEPROM_PAGE * EEPROM_PAGE; // page aligned, blocks start on a page
+	if(*next > (isAuto ? EEPROM_SIZE : EEPROM_SIZE / 2)) *overflow = true;
+	return addr;
+}
+
+void CO_eeprom_readBlock(void *storageModule, uint8_t *data, size_t eepromAddr, size_t len)
+{
+	eeprom_t *e = storageModule;
+	memcpy(data, &e->mem[eepromAddr], len);
+	e->rd += len;
+}
+
+bool_t CO_eeprom_writeBlock(void *storageModule, uint8_t *data, size_t eepromAddr, size_t len)
+{
+	eeprom_t *e = storageModule;
+	if(eepromAddr / EEPROM_PAGE != (eepromAddr + len - 1) / EEPROM_PAGE && eepromAddr % EEPROM_PAGE) return false;
+	memcpy(&e->mem[eepromAddr], data, len);
+	e->wr += len; // a page write programs all of it
+	return true;
+}
+
+uint16_t CO_eeprom_getCrcBlock(void *storageModule, size_t eepromAddr, size_t len)
+{
+	eeprom_t *e = storageModule;
+	e->rd += len;
+	return crc16_ccitt(&e->mem[eepromAddr], len, 0);
+}
+
+bool_t CO_eeprom_updateByte(void *storageModule, uint8_t data, size_t eepromAddr)
+{
+	eeprom_t *e = storageModule;
+	e->rd++;
+	if(e->mem[eepromAddr] != data)
+	{
+		e->mem[eepromAddr] = data;
+		e->wr++;
+	}
+	return true;
+}
@@ -0,0 +1,21 @@
+#ifndef EEPROM_H__
+#define EEPROM_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// 25LC256 stand-in for CO_eeprom.h in RAM: 32 KiB, 64 byte pages, protected blocks from the bottom, auto blocks
+// from the middle. Counts the bytes read and programmed: all of a block write, changed ones of a byte update
+#define EEPROM_SIZE 32768
+#define EEPROM_PAGE 64
+
+typedef struct
+{
+	uint8_t mem[EEPROM_SIZE];
+	size_t next_prot, next_auto;
+	uint64_t rd, wr;
+} eeprom_t;
+
+void eeprom_blank(eeprom_t *e);
+
+#endif // EEPROM_H__
@@ -0,0 +1,143 @@
+// CO_storageEeprom on the driver OD without and with dirty tracking (CO_CONFIG_STORAGE_DIRTY, CO_STORAGE_BLOCK_SIZE
+// byte blocks): OD_PERSIST_COMM stored on command (0x1010), OD_RAM updated automatically.
+//  - store: 0x1010 "save" after one OD_set_u16(0x1017), bytes programmed and time per store, then a restart
+//  - auto:  OD_set_u32(0x6000 sub 3), CO_storageEeprom_auto_process() calls until the eeprom holds the change
+//  - idle:  CO_storageEeprom_auto_process() without changes, time and eeprom bytes read per call
+// usage: program [cycles]
+#include "storage/CO_storageEeprom.h"
+#include "OD.h"
+#include "eeprom.h"
+#include "timedate.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CYCLES 1000
+#define IDLE_CALLS 1000 // per cycle
+#define SAVE 0x65766173
+
+static eeprom_t ee;
+static CO_storage_t storage;
+static CO_storage_entry_t entries[2];
+static uint32_t dirty_comm[CO_STORAGE_DIRTY_WORDS(sizeof(OD_PERSIST_COMM))];
+static uint32_t dirty_ram[CO_STORAGE_DIRTY_WORDS(sizeof(OD_RAM))];
+static uint16_t crc_comm[CO_STORAGE_BLOCKS(sizeof(OD_PERSIST_COMM))];
+static CO_storage_hook_t hooks[256]; // more than the objects of the OD
+
+// CO_storageEeprom_init() and the write hooks, after CO_storage_untrack() on a restart
+static CO_ReturnError_t init(uint32_t *err)
+{
+	const CO_ReturnError_t ret = CO_storageEeprom_init(&storage, NULL, &ee, OD_ENTRY_H1010, OD_ENTRY_H1011, entries, 2, err);
+	if(CO_storage_track(&storage, OD, hooks, sizeof(hooks) / sizeof(hooks[0])) != CO_ERROR_NO) return CO_ERROR_OUT_OF_MEMORY;
+	return ret;
+}
+
+// Blank eeprom, all stored once
+static int setup(bool tracked)
+{
+	CO_storage_untrack(&storage);
+	eeprom_blank(&ee);
+	memset(entries, 0, sizeof(entries));
+	entries[0].addr = &OD_PERSIST_COMM;
+	entries[0].len = sizeof(OD_PERSIST_COMM);
+	entries[0].subIndexOD = 2;
+	entries[0].attr = CO_storage_cmd | CO_storage_restore;
+	entries[0].storageModule = &ee;
+	entries[0].dirty = tracked ? dirty_comm : NULL;
+	entries[0].blockCrc = crc_comm;
+	entries[1].addr = &OD_RAM;
+	entries[1].len = sizeof(OD_RAM);
+	entries[1].subIndexOD = 3;
+	entries[1].attr = CO_storage_auto;
+	entries[1].storageModule = &ee;
+	entries[1].dirty = tracked ? dirty_ram : NULL;
+
+	uint32_t err = 0;
+	const CO_ReturnError_t ret = init(&err);
+	if(ret != CO_ERROR_NO && ret != CO_ERROR_DATA_CORRUPT) // blank eeprom: no valid signatures
+	{
+		printf("ERR init: %d (0x%X)\n", ret, err);
+		return -1;
+	}
+	if(OD_set_u32(OD_ENTRY_H1010, 1, SAVE, false) != ODR_OK)
+	{
+		printf("ERR store all\n");
+		return -1;
+	}
+	CO_storageEeprom_auto_process(&storage, true);
+	return 0;
+}
+
+static bool stored(const CO_storage_entry_t *entry) { return !memcmp(&ee.mem[entry->eepromAddr], entry->addr, entry->len); }
+
+static int bench(const char *name, bool tracked, uint32_t cycles)
+{
+	if(setup(tracked)) return -1;
+	printf("%s: %zu + %zu bytes, %s\n", name, entries[0].len, entries[1].len, tracked ? "dirty blocks" : "untracked");
+
+	TD_V t0, t1;
+	double t = 0;
+	uint64_t wr = ee.wr, rd = ee.rd;
+	for(uint32_t i = 0; i < cycles; i++)
+	{
+		OD_set_u16(OD_ENTRY_H1017, 0, (uint16_t)(i + 1), false);
+		TD_GET(t0);
+		const ODR_t ret = OD_set_u32(OD_ENTRY_H1010, 2, SAVE, false);
+		TD_GET(t1);
+		t += TD_CALC_s(t1, t0);
+		if(ret != ODR_OK || !stored(&entries[0]))
+		{
+			printf("ERR %s: store %u\n", name, i);
+			return -1;
+		}
+	}
+	printf("  store: %7.2f us, %6.1f bytes programmed, %7.1f read (writeLast %zu, writeTotal %u)\n", t / cycles * 1e6,
+		   (double)(ee.wr - wr) / cycles, (double)(ee.rd - rd) / cycles, entries[0].writeLast, entries[0].writeTotal);
+
+	uint32_t err = 0; // a restart loads what was stored, the auto entry has no signature (never stored on command)
+	CO_storage_untrack(&storage);
+	if(init(&err) != CO_ERROR_DATA_CORRUPT ||
+	   err != 1u << entries[1].subIndexOD || !stored(&entries[0]))
+	{
+		printf("ERR %s: reload 0x%X\n", name, err);
+		return -1;
+	}
+
+	uint64_t calls = 0;
+	wr = ee.wr, rd = ee.rd;
+	for(uint32_t i = 0; i < cycles; i++)
+	{
+		OD_set_u32(OD_ENTRY_H6000, 3, i + 1, false);
+		for(uint32_t n = 0; !stored(&entries[1]); n++, calls++)
+		{
+			if(n > entries[1].len)
+			{
+				printf("ERR %s: auto %u\n", name, i);
+				return -1;
+			}
+			CO_storageEeprom_auto_process(&storage, false);
+		}
+	}
+	printf("  auto:  %7.1f calls, %6.1f bytes programmed, %7.1f read per change\n", (double)calls / cycles,
+		   (double)(ee.wr - wr) / cycles, (double)(ee.rd - rd) / cycles);
+
+	rd = ee.rd;
+	TD_GET(t0);
+	for(uint32_t i = 0; i < cycles * IDLE_CALLS; i++) CO_storageEeprom_auto_process(&storage, false);
+	TD_GET(t1);
+	printf("  idle:  %7.2f ns/call, %6.2f bytes read per call\n", (TD_CALC_s(t1, t0)) / cycles / IDLE_CALLS * 1e9,
+		   (double)(ee.rd - rd) / cycles / IDLE_CALLS);
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const uint32_t cycles = argc > 1 && atol(argv[1]) > 0 ? (uint32_t)atol(argv[1]) : CYCLES;
+	printf("CO_STORAGE_BLOCK_SIZE %u\n", CO_STORAGE_BLOCK_SIZE);
+	int ret = bench("driver OD", false, cycles);
+	if(!ret) ret = bench("driver OD", true, cycles);
+	CO_storage_untrack(&storage);
+	return ret;
+}
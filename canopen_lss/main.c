@@ -0,0 +1,182 @@
+// LSS commissioning of a whole bus from a manifest, see lss_commission.h
+// Manifest: one slave per line "vendor product serial node_id" (decimal or 0x..), '#' starts a comment
+#include "co_wrapper.h"
+#include "lss_commission.h"
+#include "slcan.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PORT_ID "VID_F055&PID_1337"
+#define MANIFEST_MAX 127
+
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+
+#define CHK(x) \
+	if((sts = x) != 0) printf("ERR %s: %s\n", #x, sp_err2_str(sts))
+
+// -1 file, else line number of the first bad line, 0 - ok
+static int manifest_load(const char *path, lss_cm_node_t *nodes, size_t *cnt)
+{
+	FILE *f = fopen(path, "r");
+	if(!f) return -1;
+	char line[256];
+	int ln = 0, err = 0;
+	*cnt = 0;
+	while(!err && fgets(line, sizeof(line), f))
+	{
+		ln++;
+		char *p = strchr(line, '#');
+		if(p) *p = 0;
+		p = line;
+		while(*p == ' ' || *p == '\t') p++;
+		if(*p == '\r' || *p == '\n' || !*p) continue;
+
+		unsigned long v[4];
+		char *end = p;
+		int i = 0;
+		for(; i < 4; i++)
+		{
+			v[i] = strtoul(end, &p, 0);
+			if(p == end || v[i] > 0xFFFFFFFFUL) break;
+			end = p;
+		}
+		while(*end == ' ' || *end == '\t' || *end == '\r' || *end == '\n') end++;
+		if(i < 4 || *end || v[3] < 1 || v[3] > 127 || *cnt >= MANIFEST_MAX)
+		{
+			err = ln;
+			break;
+		}
+		lss_cm_node_t *n = &nodes[(*cnt)++];
+		memset(n, 0, sizeof(*n));
+		n->addr.identity.vendorID = (uint32_t)v[0];
+		n->addr.identity.productCode = (uint32_t)v[1];
+		n->addr.identity.serialNumber = (uint32_t)v[2];
+		n->node_id = (uint8_t)v[3];
+	}
+	fclose(f);
+	return err;
+}
+
+static void on_node(void *priv, const CO_LSS_address_t *addr, uint8_t node_id, int ret)
+{
+	(void)priv;
+	printf("0x%08X 0x%08X 0x%08X -> ", addr->identity.vendorID, addr->identity.productCode, addr->identity.serialNumber);
+	if(!node_id)
+		printf("not in the manifest, no free node-ID\n");
+	else if(ret)
+		printf("%u ERR %d\n", node_id, ret);
+	else
+		printf("%u\n", node_id);
+	fflush(stdout);
+}
+
+static const char *state_str(lss_cm_state_t s)
+{
+	switch(s)
+	{
+	case LSS_CM_ASSIGNED: return "assigned";
+	case LSS_CM_ABSENT: return "absent";
+	case LSS_CM_FAILED: return "FAILED";
+	default: return "pending";
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	const char *port = NULL, *manifest = NULL;
+	lss_cm_t cm = {.on_node = on_node};
+	bool ok = true;
+	for(int i = 1; i < argc && ok; i++)
+	{
+		if(!strcmp(argv[i], "-p") && i + 1 < argc)
+			port = argv[++i];
+		else if(!strcmp(argv[i], "-b") && i + 1 < argc)
+			cm.kbit_s = (uint16_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-d") && i + 1 < argc)
+			cm.switch_delay_ms = (uint16_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-s"))
+			cm.store = true;
+		else if(!strcmp(argv[i], "-r"))
+			cm.reset = true;
+		else if(!strcmp(argv[i], "-P") && i + 1 < argc)
+		{
+			unsigned first, last;
+			ok = sscanf(argv[++i], "%u-%u", &first, &last) == 2 && first >= 1 && first <= last && last <= 127;
+			cm.pool_first = (uint8_t)first;
+			cm.pool_last = (uint8_t)last;
+		}
+		else if(!strcmp(argv[i], "-t") && i + 1 < argc)
+			ok = sscanf(argv[++i], "%u-%u", &cm.timeout_min_us, &cm.timeout_max_us) == 2;
+		else if(argv[i][0] != '-' && !manifest)
+			manifest = argv[i];
+		else
+			ok = false;
+	}
+	if(!ok || !manifest)
+	{
+		fprintf(stderr, "Error! Wrong arguments!\nUsage: [-p port] [-b kbit_s [-d delay_ms]] [-s] [-r] [-P first-last] [-t min_us-max_us] manifest\n"
+						"  manifest - lines \"vendor product serial node_id\"\n"
+						"  -p       - serial port, default: the first adapter found\n"
+						"  -b       - bit timing for the configured slaves, activated once at the end (switch delay -d)\n"
+						"  -s       - store the configuration in the slaves\n"
+						"  -r       - NMT reset communication of all nodes at the end\n"
+						"  -P       - node-IDs for unconfigured slaves outside the manifest\n"
+						"  -t       - bounds of the adaptive fastscan timeout, default 1000-100000 us\n");
+		return -1;
+	}
+
+	static lss_cm_node_t nodes[MANIFEST_MAX];
+	size_t cnt;
+	const int err = manifest_load(manifest, nodes, &cnt);
+	if(err)
+	{
+		if(err < 0)
+			printf("ERR manifest: %s\n", manifest);
+		else
+			printf("ERR manifest: %s:%d\n", manifest, err);
+		return -1;
+	}
+
+	CO_t *co = NULL;
+	int sts;
+	sp_list_t list = {0};
+	sp_t sp = {0};
+
+	if(port)
+		snprintf(sp.port_name, sizeof(sp.port_name), "%s", port);
+	else
+		while(sp_enumerate(&list))
+			if(strstr(list.info.hardware_id, PORT_ID) != NULL)
+			{
+				strcat(sp.port_name, list.info.port);
+				printf("Using %s %s %s\n", list.info.port, list.info.description, list.info.hardware_id);
+				sp_enumerate_finish(&list);
+				break;
+			}
+
+	CHK(co_wrapper_init(&co, &sp, NULL));
+	if(sts) goto FIN;
+	CHK(sp_open(&sp, 0, sp_rx, co));
+	if(sts) goto FIN;
+
+	printf("===== LSS commissioning, %zu manifest entries =====\n", cnt);
+	const int ret = lss_cm_run(co, &cm, nodes, cnt);
+	if(ret) printf("ERR stopped: %d\n", ret);
+
+	printf("===== manifest =====\n");
+	for(size_t i = 0; i < cnt; i++)
+		printf("0x%08X 0x%08X 0x%08X %3u %s\n", nodes[i].addr.identity.vendorID, nodes[i].addr.identity.productCode,
+			   nodes[i].addr.identity.serialNumber, nodes[i].node_id, state_str(nodes[i].state));
+	printf("===== %u configured, %u unknown left unconfigured, %.3f s =====\n", cm.configured, cm.unknown, (double)cm.elapsed_us / 1e6);
+	printf("round trips %u (%u without answer), unconfirmed %u, answer %u..%u us, fastscan timeout %u us\n",
+		   cm.round_trips, cm.no_answer, cm.unconfirmed, cm.rtt_min_us, cm.rtt_max_us, cm.timeout_us);
+	sts = ret;
+
+FIN:
+	sp_close(&sp);
+	co_wrapper_deinit(&co);
+	return sts;
+}
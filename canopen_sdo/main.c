@@ -1,17 +1,22 @@
 #include "../percent_tracker.h"
 #include "co_wrapper.h"
+#include "od_dcf.h"
+#include "od_scan.h"
+#include "od_store.h"
 #include "sdo.h"
 #include "slcan.h"
+#include "../timedate.h"
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
 
 #define PORT_ID "VID_F055&PID_1337"
 
-static void sp_rx(sp_t *sp, const uint8_t *data, size_t len) { slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
 
 #define CHK(x) \
 	if((sts = x) != 0) printf("ERR %s: %s\n", #x, sp_err2_str(sts))
@@ -104,12 +109,93 @@ static void print_data_hex(const uint8_t *data, uint32_t sz)
 	}
 }
 
+// Printed as soon as the entry was read, the index is shown on its first sub-index only
+static void print_entry(const od_rec_t *r, bool idx_printed)
+{
+	if(idx_printed)
+		printf("       : 0x%x [%2u ]: ", r->sub_index, r->size);
+	else
+		printf("0x%04X : 0x%x [%2u ]: ", r->index, r->sub_index, r->size);
+	print_data(od_rec_data(r), r->size);
+	print_data_hex(od_rec_data(r), r->size);
+	printf("\n");
+	fflush(stdout);
+}
+
+static struct
+{
+	bool multi; // several nodes: lines are interleaved, prefixed by the node
+	int32_t last_index[128];
+} out;
+
+static void on_entry(void *priv, uint8_t node_id, const od_rec_t *r)
+{
+	(void)priv;
+	fprintf(stderr, "\r\033[K"); // progress line
+	if(out.multi) printf("[%3u] ", node_id);
+	print_entry(r, !out.multi && out.last_index[node_id] == r->index);
+	out.last_index[node_id] = r->index;
+}
+
+// Heartbeat/bootup producers seen on the bus (network mode)
+static volatile bool hb_seen[128];
+
+void cb_co_frame_rx(void *priv, can_msg_t *msg)
+{
+	(void)priv;
+	if(msg->IDE || msg->RTR || msg->DLC != 1) return;
+	if(msg->id.std > CO_CAN_ID_HEARTBEAT && msg->id.std <= CO_CAN_ID_HEARTBEAT + 127) hb_seen[msg->id.std - CO_CAN_ID_HEARTBEAT] = true;
+}
+
+static void on_done(void *priv, uint8_t node_id, od_store_t *store, bool alive)
+{
+	(void)priv;
+	fprintf(stderr, "\r\033[K");
+	if(alive)
+		printf("===== node %u: %zu entries, %zu bytes =====\n", node_id, store->cnt, store->len);
+	else
+		printf("===== node %u: no response =====\n", node_id);
+	fflush(stdout);
+}
+
 int main(int argc, char *argv[])
 {
-	if(argc != 2)
+	const char *port = NULL, *eds_path = NULL, *out_dir = NULL;
+	bool all = false, net = false;
+	uint32_t timeout_ms = 100, listen_ms = 2000;
+	uint8_t ids[127];
+	size_t id_cnt = 0;
+	for(int i = 1; i < argc; i++)
 	{
-		fprintf(stderr, "Error! Wrong argument count!\nUsage:\n"
-						"  id      - device CAN ID\n");
+		if(!strcmp(argv[i], "-p") && i + 1 < argc)
+			port = argv[++i];
+		else if(!strcmp(argv[i], "-e") && i + 1 < argc)
+			eds_path = argv[++i];
+		else if(!strcmp(argv[i], "-t") && i + 1 < argc)
+			timeout_ms = (uint32_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-w") && i + 1 < argc)
+			listen_ms = (uint32_t)atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-o") && i + 1 < argc)
+			out_dir = argv[++i];
+		else if(!strcmp(argv[i], "-a"))
+			all = true;
+		else if(!strcmp(argv[i], "-n"))
+			net = true;
+		else if(atoi(argv[i]) >= 1 && atoi(argv[i]) <= 127 && id_cnt < 127)
+			ids[id_cnt++] = (uint8_t)atoi(argv[i]);
+		else
+			id_cnt = 0, net = false, argc = 0;
+	}
+	if(id_cnt == 0 && !net)
+	{
+		fprintf(stderr, "Error! Wrong arguments!\nUsage: [-p port] [-e file.eds] [-a] [-t timeout_ms] [-n [-w listen_ms]] [-o dir] [id ...]\n"
+						"  -p      - serial port, default: the first adapter found\n"
+						"  id      - device CAN ID, several are scanned in parallel\n"
+						"  -e      - scan the EDS objects first (their ObjectType is used)\n"
+						"  -a      - all indices, not only 0x1000..0x9FFF\n"
+						"  -t      - SDO timeout, default 100 ms\n"
+						"  -n      - add the nodes that send heartbeat/bootup within listen_ms (default 2000 ms)\n"
+						"  -o      - write dir/node_NNN.dcf and a concise DCF dir/node_NNN.cdcf per node, no table output\n");
 		return -1;
 	}
 
@@ -122,75 +208,90 @@ int main(int argc, char *argv[])
 	while(sp_enumerate(&list))
 		if(strstr(list.info.port, "ttyS") == NULL) printf("\t%s#%s#%s\n", list.info.port, list.info.description, list.info.hardware_id);
 
-	while(sp_enumerate(&list))
-		if(strstr(list.info.hardware_id, PORT_ID) != NULL)
-		{
-			strcat(sp.port_name, list.info.port);
-			printf("Using %s %s %s\n", list.info.port, list.info.description, list.info.hardware_id);
-			sp_enumerate_finish(&list);
-			break;
-		}
+	if(port)
+		snprintf(sp.port_name, sizeof(sp.port_name), "%s", port);
+	else
+		while(sp_enumerate(&list))
+			if(strstr(list.info.hardware_id, PORT_ID) != NULL)
+			{
+				strcat(sp.port_name, list.info.port);
+				printf("Using %s %s %s\n", list.info.port, list.info.description, list.info.hardware_id);
+				sp_enumerate_finish(&list);
+				break;
+			}
 
-	CHK(co_wrapper_init(&co, &sp));
+	CHK(co_wrapper_init(&co, &sp, NULL));
 	if(sts) goto FIN;
 	CHK(sp_open(&sp, 0, sp_rx, co));
 	if(sts) goto FIN;
 
-	uint8_t id = atoi(argv[1]);
-	printf("===== SDO table for device ID: %d =====\n", id);
-	typedef struct
+	od_eds_t eds = {0};
+	if(eds_path && od_eds_load(&eds, eds_path))
+	{
+		printf("ERR EDS: %s\n", eds_path);
+		goto FIN;
+	}
+
+	if(net)
+	{
+		printf("listening for heartbeat/bootup %u ms...\n", listen_ms);
+		SLEEP_MS(listen_ms);
+		for(uint8_t id = 1; id <= 127; id++)
+		{
+			bool listed = false;
+			for(size_t i = 0; i < id_cnt; i++) listed |= ids[i] == id;
+			if(hb_seen[id] && !listed && id_cnt < 127) ids[id_cnt++] = id;
+		}
+	}
+	if(!id_cnt)
+	{
+		printf("no nodes found\n");
+		goto FIN_EDS;
+	}
+
+	od_scan_plan_t plan;
+	if(od_scan_plan_init(&plan, eds_path ? &eds : NULL, all))
 	{
-		uint32_t error;
-		size_t readed_size;
-		uint8_t storage[256];
-	} entry_t;
-	uint8_t *mem = malloc(65536 * 256 * sizeof(entry_t));
-	memset(mem, 0xFF, 65536 * 256 * sizeof(entry_t));
+		printf("ERR plan: out of memory\n");
+		goto FIN_EDS;
+	}
+	printf("===== SDO table for %zu device(s), %zu indices =====\n", id_cnt, plan.cnt);
 
-	entry_t *e = (entry_t *)mem;
+	out.multi = id_cnt > 1;
+	for(size_t i = 0; i < 128; i++) out.last_index[i] = -1;
 
+	od_scan_t scan;
 	PERCENT_TRACKER_INIT(tr);
 	char el[128], est[128];
-	for(uint32_t idx = 0; idx <= 0xFFFF; idx++)
+	if(od_scan_start(&scan, &co->sdo_async, &plan, ids, id_cnt, timeout_ms, out_dir ? NULL : on_entry, on_done, NULL) == 0)
 	{
-		for(uint32_t sub = 0; sub < 256; sub++)
+		while(!od_scan_done(&scan))
 		{
-			PERCENT_TRACKER_TRACK(tr, (double)(idx * 256 + sub) / (double)(65536 * 256),
+			PERCENT_TRACKER_TRACK(tr, od_scan_progress(&scan),
 								  { tr.time_ms_pass > 60000 ? sprintf(el, "%lld min %lld sec", tr.time_ms_pass / 60000, (tr.time_ms_pass / 1000) % 60) : sprintf(el, "%lld sec", tr.time_ms_pass / 1000);
 								 	tr.time_ms_est > 60000 ? sprintf(est, "%lld min %lld sec", tr.time_ms_est / 60000, (tr.time_ms_est / 1000) % 60) : sprintf(est, "%lld sec", tr.time_ms_est / 1000); 
-									fprintf(stderr, "\rinfo:  x%04x x%x ...  %.1f%% | pass: %s | est: %s        ",
-											idx, sub, 100.0 * tr.progress, el, est); });
-			e[idx * 256 + sub].readed_size = sizeof(e[idx * 256 + sub].storage);
-			e[idx * 256 + sub].error = read_SDO(co->SDOclient, id, idx, sub, e[idx * 256 + sub].storage, sizeof(e[idx * 256 + sub].storage),
-												&e[idx * 256 + sub].readed_size, 100);
-			e[idx * 256 + sub].storage[e[idx * 256 + sub].readed_size] = 0;
-			if(e[idx * 256 + sub].error == CO_SDO_AB_NOT_EXIST) break;
-			if(e[idx * 256 + sub].error == CO_SDO_AB_SUB_UNKNOWN) break;
+									fprintf(stderr, "\rinfo:  %.1f%% | pass: %s | est: %s        ",
+											100.0 * tr.progress, el, est); });
+			SLEEP_MS(20);
 		}
-	}
-	printf("\n");
-	{
-		for(uint32_t idx = 0; idx <= 0xFFFF; idx++)
+		fprintf(stderr, "\r\033[K");
+
+		for(size_t i = 0; out_dir && i < scan.node_cnt; i++)
 		{
-			bool idx_printed = false;
-			for(uint32_t sub = 0; sub < 256; sub++)
-			{
-				if(e[idx * 256 + sub].error == 0)
-				{
-					if(idx_printed)
-						printf("       : 0x%x [%2lld ]: ", sub, e[idx * 256 + sub].readed_size);
-					else
-						printf("0x%04X : 0x%x [%2lld ]: ", idx, sub, e[idx * 256 + sub].readed_size);
-					print_data(e[idx * 256 + sub].storage, e[idx * 256 + sub].readed_size);
-					print_data_hex(e[idx * 256 + sub].storage, e[idx * 256 + sub].readed_size);
-					printf("\n");
-					idx_printed = true;
-				}
-			}
+			const od_scan_node_t *n = &scan.nodes[i];
+			if(!n->alive) continue;
+			char path[1024];
+			snprintf(path, sizeof(path), "%s/node_%03u.dcf", out_dir, n->node_id);
+			if(od_dcf_write(path, n->node_id, &n->store, eds_path ? &eds : NULL)) printf("ERR write %s\n", path);
+			snprintf(path, sizeof(path), "%s/node_%03u.cdcf", out_dir, n->node_id);
+			if(od_cdcf_write(path, &n->store, eds_path ? &eds : NULL)) printf("ERR write %s\n", path);
 		}
+		od_scan_free(&scan);
 	}
+	od_scan_plan_free(&plan);
 
-	free(mem);
+FIN_EDS:
+	od_eds_free(&eds);
 
 FIN:
 	printf("waiting port close...\n");
@@ -0,0 +1,212 @@
+#include "od_dcf.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static uint64_t le_uint(const uint8_t *data, uint32_t size)
+{
+	uint64_t v = 0;
+	for(uint32_t i = size > 8 ? 8 : size; i > 0; i--) v = (v << 8) | data[i - 1];
+	return v;
+}
+
+static bool dt_signed(uint16_t dt) { return dt == OD_DT_INTEGER8 || dt == OD_DT_INTEGER16 || dt == OD_DT_INTEGER32 || (dt >= 0x0010 && dt <= 0x0015 && dt != OD_DT_REAL64); }
+static bool dt_unsigned(uint16_t dt) { return dt == OD_DT_BOOLEAN || (dt >= OD_DT_UNSIGNED8 && dt <= OD_DT_UNSIGNED32) || dt == 0x0016 || (dt >= 0x0018 && dt <= OD_DT_UNSIGNED64); }
+
+// Without the EDS the data type follows the size
+static uint16_t rec_type(const od_rec_t *r, const od_eds_ent_t *e)
+{
+	if(e && e->data_type) return e->data_type;
+	switch(r->size)
+	{
+	case 1: return OD_DT_UNSIGNED8;
+	case 2: return OD_DT_UNSIGNED16;
+	case 4: return OD_DT_UNSIGNED32;
+	case 8: return OD_DT_UNSIGNED64;
+	default: return OD_DT_DOMAIN;
+	}
+}
+
+static void write_value(FILE *f, uint16_t dt, const uint8_t *data, uint32_t size)
+{
+	if(size && size <= 8 && dt_unsigned(dt))
+		fprintf(f, "0x%llX", (unsigned long long)le_uint(data, size));
+	else if(size && size <= 8 && dt_signed(dt))
+	{
+		const unsigned shift = 64 - 8 * size;
+		fprintf(f, "%lld", (long long)(le_uint(data, size) << shift) >> shift);
+	}
+	else if(dt == OD_DT_REAL32 && size == 4)
+	{
+		float v;
+		memcpy(&v, data, 4);
+		fprintf(f, "%.9g", v);
+	}
+	else if(dt == OD_DT_REAL64 && size == 8)
+	{
+		double v;
+		memcpy(&v, data, 8);
+		fprintf(f, "%.17g", v);
+	}
+	else if(dt == OD_DT_VISIBLE_STRING)
+	{
+		for(uint32_t i = 0; i < size && data[i]; i++)
+			if(data[i] >= 0x20 && data[i] < 0x7F) fputc(data[i], f);
+	}
+	else
+	{
+		for(uint32_t i = 0; i < size; i++) fprintf(f, "%02X", data[i]);
+	}
+}
+
+// Entries of one index are stored together, starting at sub-index 0
+static const od_rec_t *obj_end(const od_store_t *store, const od_rec_t *r, uint16_t *sub_cnt)
+{
+	const uint16_t index = r->index;
+	*sub_cnt = 0;
+	for(; r && r->index == index; r = od_store_next(store, r)) (*sub_cnt)++;
+	return r;
+}
+
+static void write_sub(FILE *f, const char *section, const od_rec_t *r, const od_eds_ent_t *e)
+{
+	fprintf(f, "[%s]\n", section);
+	if(e && e->name[0])
+		fprintf(f, "ParameterName=%s\n", e->name);
+	else if(r->sub_index == 0)
+		fprintf(f, "ParameterName=Highest sub-index supported\n");
+	else
+		fprintf(f, "ParameterName=Sub-index %u\n", r->sub_index);
+	const uint16_t dt = rec_type(r, e);
+	fprintf(f, "ObjectType=0x7\n");
+	fprintf(f, "DataType=0x%04X\n", dt);
+	fprintf(f, "AccessType=%s\n", e && e->access[0] ? e->access : "ro"); // unknown: not offered for writing
+	fprintf(f, "ParameterValue=");
+	write_value(f, dt, od_rec_data(r), r->size);
+	fprintf(f, "\n\n");
+}
+
+static const od_rec_t *find(const od_store_t *store, uint16_t index, uint8_t sub_index)
+{
+	for(const od_rec_t *r = od_store_first(store); r; r = od_store_next(store, r))
+		if(r->index == index && r->sub_index == sub_index) return r;
+	return NULL;
+}
+
+// CiA 306 object lists: 0 - mandatory, 1 - optional, 2 - manufacturer
+static int obj_kind(uint16_t index) { return (index == 0x1000 || index == 0x1001 || index == 0x1018) ? 0 : (index >= 0x2000 && index <= 0x5FFF) ? 2 : 1; }
+
+static void write_objects_list(FILE *f, const od_store_t *store, const char *section, int kind)
+{
+	uint16_t cnt = 0, n = 0, sub_cnt;
+	for(const od_rec_t *r = od_store_first(store); r; r = obj_end(store, r, &sub_cnt)) cnt += obj_kind(r->index) == kind ? 1 : 0;
+	fprintf(f, "[%s]\nSupportedObjects=%u\n", section, cnt);
+	for(const od_rec_t *r = od_store_first(store); r; r = obj_end(store, r, &sub_cnt))
+		if(obj_kind(r->index) == kind) fprintf(f, "%u=0x%04X\n", ++n, r->index);
+	fprintf(f, "\n");
+}
+
+int od_dcf_write(const char *path, uint8_t node_id, const od_store_t *store, const od_eds_t *eds)
+{
+	FILE *f = fopen(path, "w");
+	if(!f) return 1;
+
+	const char *name = path;
+	for(const char *p = path; *p; p++)
+		if(*p == '/' || *p == '\\') name = p + 1;
+	char tm_s[32] = "", dt_s[32] = "";
+	const time_t now = time(NULL);
+	const struct tm *tm = localtime(&now);
+	if(tm)
+	{
+		strftime(tm_s, sizeof(tm_s), "%I:%M%p", tm);
+		strftime(dt_s, sizeof(dt_s), "%m-%d-%Y", tm);
+	}
+	fprintf(f, "[FileInfo]\nFileName=%s\nFileVersion=1\nFileRevision=1\nEDSVersion=4.0\n"
+			   "Description=Configuration read from node %u\nCreationTime=%s\nCreationDate=%s\nCreatedBy=canopen_sdo\n\n",
+			name, node_id, tm_s, dt_s);
+
+	const od_rec_t *r;
+	fprintf(f, "[DeviceInfo]\n");
+	if((r = find(store, 0x1018, 1)) != NULL && r->size == 4) fprintf(f, "VendorNumber=0x%08llX\n", (unsigned long long)le_uint(od_rec_data(r), 4));
+	if((r = find(store, 0x1008, 0)) != NULL)
+	{
+		fprintf(f, "ProductName=");
+		write_value(f, OD_DT_VISIBLE_STRING, od_rec_data(r), r->size);
+		fprintf(f, "\n");
+	}
+	if((r = find(store, 0x1018, 2)) != NULL && r->size == 4) fprintf(f, "ProductNumber=0x%08llX\n", (unsigned long long)le_uint(od_rec_data(r), 4));
+	if((r = find(store, 0x1018, 3)) != NULL && r->size == 4) fprintf(f, "RevisionNumber=0x%08llX\n", (unsigned long long)le_uint(od_rec_data(r), 4));
+	fprintf(f, "\n[DeviceComissioning]\nNodeID=0x%02X\n\n", node_id);
+
+	write_objects_list(f, store, "MandatoryObjects", 0);
+	write_objects_list(f, store, "OptionalObjects", 1);
+	write_objects_list(f, store, "ManufacturerObjects", 2);
+
+	uint16_t sub_cnt;
+	for(r = od_store_first(store); r;)
+	{
+		const od_rec_t *next = obj_end(store, r, &sub_cnt);
+		const od_eds_ent_t *obj = od_eds_find_obj(eds, r->index);
+		char section[16];
+		if(sub_cnt == 1 && r->sub_index == 0 && (!obj || obj->object_type == OD_OBJ_VAR))
+		{
+			snprintf(section, sizeof(section), "%04X", r->index);
+			write_sub(f, section, r, od_eds_find(eds, r->index, 0));
+		}
+		else
+		{
+			fprintf(f, "[%04X]\n", r->index);
+			if(obj && obj->name[0])
+				fprintf(f, "ParameterName=%s\n", obj->name);
+			else
+				fprintf(f, "ParameterName=Object %04X\n", r->index);
+			fprintf(f, "ObjectType=0x%X\nSubNumber=0x%X\n\n", obj && obj->object_type == OD_OBJ_ARRAY ? OD_OBJ_ARRAY : OD_OBJ_RECORD, sub_cnt);
+			for(; r != next; r = od_store_next(store, r))
+			{
+				snprintf(section, sizeof(section), "%04Xsub%X", r->index, r->sub_index);
+				write_sub(f, section, r, od_eds_find(eds, r->index, r->sub_index));
+			}
+		}
+		r = next;
+	}
+
+	return fclose(f) ? 1 : 0;
+}
+
+static bool cdcf_keep(const od_rec_t *r, const od_eds_t *eds)
+{
+	if(!eds) return true;
+	const od_eds_ent_t *e = od_eds_find(eds, r->index, r->sub_index);
+	return e && strchr(e->access, 'w') != NULL; // rw, wo, rww, rwr
+}
+
+static void put_le(uint8_t *buf, uint64_t v, int n)
+{
+	for(int i = 0; i < n; i++, v >>= 8) buf[i] = (uint8_t)v;
+}
+
+int od_cdcf_write(const char *path, const od_store_t *store, const od_eds_t *eds)
+{
+	FILE *f = fopen(path, "wb");
+	if(!f) return 1;
+
+	uint32_t cnt = 0;
+	for(const od_rec_t *r = od_store_first(store); r; r = od_store_next(store, r)) cnt += cdcf_keep(r, eds) ? 1 : 0;
+
+	uint8_t hdr[7];
+	put_le(hdr, cnt, 4);
+	int ret = fwrite(hdr, 4, 1, f) != 1;
+	for(const od_rec_t *r = od_store_first(store); r && !ret; r = od_store_next(store, r))
+	{
+		if(!cdcf_keep(r, eds)) continue;
+		put_le(&hdr[0], r->index, 2);
+		hdr[2] = r->sub_index;
+		put_le(&hdr[3], r->size, 4);
+		ret = fwrite(hdr, sizeof(hdr), 1, f) != 1 || (r->size && fwrite(od_rec_data(r), r->size, 1, f) != 1);
+	}
+	if(fclose(f)) ret = 1;
+	return ret;
+}
@@ -0,0 +1,25 @@
+#ifndef OD_DCF_H__
+#define OD_DCF_H__
+
+#include "od_eds.h"
+#include "od_store.h"
+#include <stdint.h>
+
+/**
+ * @brief Writes the scanned entries as a CiA 306 DCF (ParameterValue = the value read)
+ *
+ * @param eds optional: names, data and access types; without it the data type follows the size
+ * @return int 0 on success
+ */
+int od_dcf_write(const char *path, uint8_t node_id, const od_store_t *store, const od_eds_t *eds);
+
+/**
+ * @brief Writes a concise DCF (CiA 302-3, as used by 0x1F22): UNSIGNED32 entry count, then
+ * UNSIGNED16 index, UNSIGNED8 sub-index, UNSIGNED32 size and the data per entry, little endian
+ *
+ * @param eds optional: only writable entries are kept when given, all entries without it
+ * @return int 0 on success
+ */
+int od_cdcf_write(const char *path, const od_store_t *store, const od_eds_t *eds);
+
+#endif // OD_DCF_H__
@@ -0,0 +1,128 @@
+#include "od_eds.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+static uint32_t ent_key(uint16_t index, bool is_sub, uint8_t sub_index) { return ((uint32_t)index << 9) | ((uint32_t)is_sub << 8) | sub_index; }
+
+static int ent_cmp(const void *a, const void *b)
+{
+	const od_eds_ent_t *ea = *(od_eds_ent_t *const *)a, *eb = *(od_eds_ent_t *const *)b;
+	const uint32_t ka = ent_key(ea->index, ea->is_sub, ea->sub_index), kb = ent_key(eb->index, eb->is_sub, eb->sub_index);
+	return ka < kb ? -1 : ka > kb;
+}
+
+// "[XXXX]" or "[XXXXsubN]", returns false for any other section
+static bool parse_section(const char *line, od_eds_ent_t *e)
+{
+	for(int i = 1; i <= 4; i++)
+		if(!isxdigit((unsigned char)line[i])) return false;
+	char *end;
+	memset(e, 0, sizeof(*e));
+	e->index = (uint16_t)strtoul(&line[1], &end, 16);
+	if(end != &line[5]) return false;
+	e->object_type = OD_OBJ_VAR;
+	if(line[5] == ']') return true;
+	if(strncasecmp(&line[5], "sub", 3) || !isxdigit((unsigned char)line[8])) return false;
+	const unsigned long sub = strtoul(&line[8], &end, 16);
+	if(*end != ']' || sub > 0xFF) return false;
+	e->is_sub = true;
+	e->sub_index = (uint8_t)sub;
+	return true;
+}
+
+int od_eds_load(od_eds_t *eds, const char *path)
+{
+	memset(eds, 0, sizeof(*eds));
+	FILE *f = fopen(path, "r");
+	if(!f) return 1;
+
+	size_t cap = 0;
+	od_eds_ent_t *cur = NULL;
+	char line[256];
+	while(fgets(line, sizeof(line), f))
+	{
+		line[strcspn(line, "\r\n")] = 0;
+		if(line[0] == '[')
+		{
+			od_eds_ent_t e;
+			cur = NULL;
+			if(!parse_section(line, &e)) continue;
+			if(eds->cnt == cap)
+			{
+				cap = cap ? cap * 2 : 256;
+				od_eds_ent_t *ent = realloc(eds->ent, cap * sizeof(*ent));
+				if(!ent)
+				{
+					fclose(f);
+					od_eds_free(eds);
+					return 1;
+				}
+				eds->ent = ent;
+			}
+			cur = &eds->ent[eds->cnt++];
+			*cur = e;
+			continue;
+		}
+		if(!cur) continue;
+		char *val = strchr(line, '=');
+		if(!val) continue;
+		*val++ = 0;
+		if(!strcasecmp(line, "ObjectType"))
+			cur->object_type = (uint8_t)strtoul(val, NULL, 0);
+		else if(!strcasecmp(line, "DataType"))
+			cur->data_type = (uint16_t)strtoul(val, NULL, 0);
+		else if(!strcasecmp(line, "AccessType"))
+			snprintf(cur->access, sizeof(cur->access), "%s", val);
+		else if(!strcasecmp(line, "ParameterName"))
+			snprintf(cur->name, sizeof(cur->name), "%s", val);
+	}
+	fclose(f);
+
+	eds->sorted = malloc((eds->cnt ? eds->cnt : 1) * sizeof(*eds->sorted));
+	if(!eds->sorted)
+	{
+		od_eds_free(eds);
+		return 1;
+	}
+	for(size_t i = 0; i < eds->cnt; i++) eds->sorted[i] = &eds->ent[i];
+	qsort(eds->sorted, eds->cnt, sizeof(*eds->sorted), ent_cmp);
+	return 0;
+}
+
+void od_eds_free(od_eds_t *eds)
+{
+	free(eds->ent);
+	free(eds->sorted);
+	memset(eds, 0, sizeof(*eds));
+}
+
+static const od_eds_ent_t *find(const od_eds_t *eds, uint32_t key)
+{
+	size_t lo = 0, hi = eds->cnt;
+	while(lo < hi)
+	{
+		const size_t mid = (lo + hi) / 2;
+		const od_eds_ent_t *e = eds->sorted[mid];
+		const uint32_t k = ent_key(e->index, e->is_sub, e->sub_index);
+		if(k == key) return e;
+		if(k < key)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return NULL;
+}
+
+const od_eds_ent_t *od_eds_find(const od_eds_t *eds, uint16_t index, uint8_t sub_index)
+{
+	if(!eds) return NULL;
+	const od_eds_ent_t *e = find(eds, ent_key(index, true, sub_index));
+	if(e || sub_index) return e;
+	e = find(eds, ent_key(index, false, 0));
+	return e && e->object_type == OD_OBJ_VAR ? e : NULL;
+}
+
+const od_eds_ent_t *od_eds_find_obj(const od_eds_t *eds, uint16_t index) { return eds ? find(eds, ent_key(index, false, 0)) : NULL; }
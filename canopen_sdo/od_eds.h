@@ -0,0 +1,57 @@
+#ifndef OD_EDS_H__
+#define OD_EDS_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// EDS ObjectType
+#define OD_OBJ_VAR 7
+#define OD_OBJ_ARRAY 8
+#define OD_OBJ_RECORD 9
+
+// EDS DataType (CiA 301 static data types)
+#define OD_DT_BOOLEAN 0x0001
+#define OD_DT_INTEGER8 0x0002
+#define OD_DT_INTEGER16 0x0003
+#define OD_DT_INTEGER32 0x0004
+#define OD_DT_UNSIGNED8 0x0005
+#define OD_DT_UNSIGNED16 0x0006
+#define OD_DT_UNSIGNED32 0x0007
+#define OD_DT_REAL32 0x0008
+#define OD_DT_VISIBLE_STRING 0x0009
+#define OD_DT_OCTET_STRING 0x000A
+#define OD_DT_DOMAIN 0x000F
+#define OD_DT_REAL64 0x0011
+#define OD_DT_INTEGER64 0x0015
+#define OD_DT_UNSIGNED64 0x001B
+
+// One "[XXXX]" or "[XXXXsubN]" section
+typedef struct
+{
+	uint16_t index;
+	uint8_t sub_index;
+	bool is_sub; // "[XXXXsubN]"
+	uint8_t object_type;
+	uint16_t data_type;
+	char access[8];
+	char name[96];
+} od_eds_ent_t;
+
+typedef struct
+{
+	od_eds_ent_t *ent; // file order
+	size_t cnt;
+	od_eds_ent_t **sorted; // by index, sub-index (lookup)
+} od_eds_t;
+
+// Returns 0 on success; only the object sections are kept, other sections are skipped
+int od_eds_load(od_eds_t *eds, const char *path);
+void od_eds_free(od_eds_t *eds);
+
+// The sub-index section, or the object section itself for a VAR (sub-index 0)
+const od_eds_ent_t *od_eds_find(const od_eds_t *eds, uint16_t index, uint8_t sub_index);
+// The "[XXXX]" section
+const od_eds_ent_t *od_eds_find_obj(const od_eds_t *eds, uint16_t index);
+
+#endif // OD_EDS_H__
@@ -0,0 +1,213 @@
+#include "od_scan.h"
+#include <stdlib.h>
+#include <string.h>
+
+// ===== scan plan =====
+
+static void plan_add(od_scan_plan_t *plan, uint8_t *seen, uint16_t index, uint8_t type)
+{
+	if(seen[index >> 3] & (1 << (index & 7))) return;
+	seen[index >> 3] |= (uint8_t)(1 << (index & 7));
+	plan->index[plan->cnt] = index;
+	plan->type[plan->cnt] = type;
+	plan->sub_last[plan->cnt] = 0;
+	// sub-index 0 is the number of entries in use, not the highest supported
+	if(index == 0x1003) plan->sub_last[plan->cnt] = 0xFE;
+	if((index >= 0x1600 && index <= 0x17FF) || (index >= 0x1A00 && index <= 0x1BFF)) plan->sub_last[plan->cnt] = 0x40;
+	plan->cnt++;
+}
+
+static void plan_add_range(od_scan_plan_t *plan, uint8_t *seen, uint32_t first, uint32_t last)
+{
+	for(uint32_t i = first; i <= last; i++) plan_add(plan, seen, (uint16_t)i, OD_SCAN_OBJ_UNKNOWN);
+}
+
+// EDS objects in file order, the sub-index sections extend sub_last
+static void plan_add_eds(od_scan_plan_t *plan, uint8_t *seen, const od_eds_t *eds)
+{
+	for(size_t i = 0; i < eds->cnt; i++)
+	{
+		const od_eds_ent_t *e = &eds->ent[i];
+		if(!e->is_sub)
+		{
+			const uint8_t t = e->object_type;
+			plan_add(plan, seen, e->index, (t == OD_OBJ_ARRAY || t == OD_OBJ_RECORD) ? t : OD_OBJ_VAR);
+		}
+		else if(plan->cnt && plan->index[plan->cnt - 1] == e->index && e->sub_index > plan->sub_last[plan->cnt - 1])
+			plan->sub_last[plan->cnt - 1] = e->sub_index;
+	}
+}
+
+int od_scan_plan_init(od_scan_plan_t *plan, const od_eds_t *eds, bool all)
+{
+	memset(plan, 0, sizeof(*plan));
+	plan->index = malloc(65536 * sizeof(*plan->index));
+	plan->type = malloc(65536);
+	plan->sub_last = malloc(65536);
+	uint8_t *seen = calloc(65536 / 8, 1);
+	if(!plan->index || !plan->type || !plan->sub_last || !seen)
+	{
+		free(seen);
+		od_scan_plan_free(plan);
+		return 1;
+	}
+
+	if(eds) plan_add_eds(plan, seen, eds);
+	plan_add_range(plan, seen, 0x1000, 0x1FFF); // communication
+	plan_add_range(plan, seen, 0x6000, 0x9FFF); // standardized device profile
+	plan_add_range(plan, seen, 0x2000, 0x5FFF); // manufacturer specific
+	if(all) plan_add_range(plan, seen, 0x0000, 0xFFFF);
+	free(seen);
+	return 0;
+}
+
+void od_scan_plan_free(od_scan_plan_t *plan)
+{
+	free(plan->index);
+	free(plan->type);
+	free(plan->sub_last);
+	memset(plan, 0, sizeof(*plan));
+}
+
+// ===== scan =====
+
+static void node_cb(co_sdo_req_t *req);
+
+static void node_finish(od_scan_node_t *n)
+{
+	od_store_drop(&n->store);
+	od_scan_t *s = n->scan;
+	n->pos = s->plan->cnt;
+	if(s->done_cb) s->done_cb(s->priv, n->node_id, &n->store, n->alive);
+	__atomic_add_fetch(&s->nodes_done, 1, __ATOMIC_RELEASE);
+}
+
+static void node_read(od_scan_node_t *n, uint8_t sub)
+{
+	od_scan_t *s = n->scan;
+	if(od_store_begin(&n->store, s->plan->index[n->pos], sub))
+	{
+		node_finish(n);
+		return;
+	}
+	co_sdo_req_t *req = &n->req;
+	memset(req, 0, sizeof(*req));
+	req->node_id = n->node_id;
+	req->index = s->plan->index[n->pos];
+	req->sub_index = sub;
+	req->sink = od_store_sink;
+	req->stream = &n->store;
+	req->timeout_ms = s->timeout_ms;
+	req->cb = node_cb;
+	req->priv = n;
+	if(co_sdo_submit(s->engine, req)) node_finish(n);
+}
+
+static void node_next_index(od_scan_node_t *n)
+{
+	if(++n->pos >= n->scan->plan->cnt)
+		node_finish(n);
+	else
+		node_read(n, 0);
+}
+
+static void node_cb(co_sdo_req_t *req)
+{
+	od_scan_node_t *n = req->priv;
+	od_scan_t *s = n->scan;
+	const uint8_t sub = req->sub_index;
+	const CO_SDO_abortCode_t result = req->result;
+
+	if(result == CO_SDO_AB_TIMEOUT)
+	{
+		od_store_drop(&n->store);
+		if(++n->fails >= OD_SCAN_MAX_FAILS)
+		{
+			node_finish(n);
+			return;
+		}
+	}
+	else
+	{
+		n->fails = 0;
+		n->alive = true;
+	}
+
+	if(result == CO_SDO_AB_NONE)
+	{
+		const od_rec_t *r = od_store_commit(&n->store);
+		if(r && s->entry_cb) s->entry_cb(s->priv, n->node_id, r);
+		if(r && sub == 0)
+		{
+			// sub-index 0 of an ARRAY/RECORD is the highest sub-index supported
+			const uint8_t type = s->plan->type[n->pos];
+			n->sub_max = (type != OD_OBJ_VAR && r->size == 1) ? od_rec_data(r)[0] : 0;
+			n->sub_end = (type != OD_OBJ_VAR && r->size == 1 && s->plan->sub_last[n->pos] > n->sub_max) ? s->plan->sub_last[n->pos] : n->sub_max;
+			n->probe = type == OD_SCAN_OBJ_UNKNOWN;
+		}
+	}
+	else
+	{
+		od_store_drop(&n->store);
+		if(sub == 0 || result == CO_SDO_AB_NOT_EXIST) n->sub_end = 0;
+		if(sub == 1 && n->probe && result == CO_SDO_AB_SUB_UNKNOWN) n->sub_end = 0; // sub-index 0 was a UNSIGNED8 VAR
+		if(sub > n->sub_max && result == CO_SDO_AB_SUB_UNKNOWN) n->sub_end = 0;
+	}
+
+	if(sub < n->sub_end)
+		node_read(n, (uint8_t)(sub + 1));
+	else
+		node_next_index(n);
+}
+
+int od_scan_start(od_scan_t *s, CO_sdo_async_t *engine, const od_scan_plan_t *plan, const uint8_t *node_ids, size_t node_cnt, uint32_t timeout_ms,
+				  od_scan_entry_cb_t entry_cb, od_scan_done_cb_t done_cb, void *priv)
+{
+	memset(s, 0, sizeof(*s));
+	s->nodes = calloc(node_cnt, sizeof(*s->nodes));
+	if(!s->nodes) return 1;
+	s->engine = engine;
+	s->plan = plan;
+	s->node_cnt = node_cnt;
+	s->timeout_ms = timeout_ms;
+	s->entry_cb = entry_cb;
+	s->done_cb = done_cb;
+	s->priv = priv;
+
+	for(size_t i = 0; i < node_cnt; i++)
+	{
+		od_scan_node_t *n = &s->nodes[i];
+		n->scan = s;
+		n->node_id = node_ids[i];
+		od_store_init(&n->store);
+	}
+	// the callbacks may run as soon as the first request is queued
+	for(size_t i = 0; i < node_cnt; i++)
+	{
+		if(plan->cnt)
+			node_read(&s->nodes[i], 0);
+		else
+			node_finish(&s->nodes[i]);
+	}
+	return 0;
+}
+
+bool od_scan_done(const od_scan_t *s)
+{
+	return __atomic_load_n(&s->nodes_done, __ATOMIC_ACQUIRE) >= s->node_cnt;
+}
+
+float od_scan_progress(const od_scan_t *s)
+{
+	if(!s->node_cnt || !s->plan->cnt) return 1.0f;
+	size_t pos = 0;
+	for(size_t i = 0; i < s->node_cnt; i++) pos += __atomic_load_n(&s->nodes[i].pos, __ATOMIC_RELAXED);
+	return (float)pos / (float)(s->node_cnt * s->plan->cnt);
+}
+
+void od_scan_free(od_scan_t *s)
+{
+	for(size_t i = 0; i < s->node_cnt; i++) od_store_free(&s->nodes[i].store);
+	free(s->nodes);
+	memset(s, 0, sizeof(*s));
+}
@@ -0,0 +1,80 @@
+#ifndef OD_SCAN_H__
+#define OD_SCAN_H__
+
+#include "CANopen.h"
+#include "od_eds.h"
+#include "od_store.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define OD_SCAN_OBJ_UNKNOWN 0 // not in the EDS (else OD_OBJ_*), the layout is probed
+
+#define OD_SCAN_MAX_FAILS 3 // consecutive timeouts before a node is given up
+
+// Indices to visit, in order
+typedef struct
+{
+	uint16_t *index;
+	uint8_t *type;
+	uint8_t *sub_last; // sub-indices to try beyond the sub-index 0 value: EDS subs, count objects
+	size_t cnt;
+} od_scan_plan_t;
+
+/**
+ * @brief Builds the scan order: the EDS objects first, then the communication (0x1000..0x1FFF),
+ * device profile (0x6000..0x9FFF) and manufacturer (0x2000..0x5FFF) ranges
+ *
+ * @param eds optional
+ * @param all append the remaining indices (data types, reserved, 0xA000..0xFFFF)
+ * @return int 0 on success
+ */
+int od_scan_plan_init(od_scan_plan_t *plan, const od_eds_t *eds, bool all);
+void od_scan_plan_free(od_scan_plan_t *plan);
+
+typedef struct od_scan_t od_scan_t;
+
+// Called from the CANopen thread for each entry read, the record is valid during the call only
+typedef void (*od_scan_entry_cb_t)(void *priv, uint8_t node_id, const od_rec_t *r);
+// Called from the CANopen thread once the node has been scanned (or given up)
+typedef void (*od_scan_done_cb_t)(void *priv, uint8_t node_id, od_store_t *store, bool alive);
+
+typedef struct
+{
+	od_scan_t *scan;
+	uint8_t node_id;
+	size_t pos;		 // plan position
+	uint8_t sub_max; // from sub-index 0
+	uint8_t sub_end; // last one to try, past sub_max it ends at the first missing one
+	bool probe;		 // not known from the EDS: sub-index 0 may be a VAR
+	uint8_t fails;
+	bool alive; // answered at least once
+	od_store_t store;
+	co_sdo_req_t req;
+} od_scan_node_t;
+
+/**
+ * Runs one sub-index 0 read per object and only the sub-indices it reports.
+ * Nodes are scanned in parallel through the async SDO engine, one transfer per node at a time.
+ */
+struct od_scan_t
+{
+	CO_sdo_async_t *engine;
+	const od_scan_plan_t *plan;
+	od_scan_node_t *nodes;
+	size_t node_cnt;
+	uint32_t timeout_ms;
+	od_scan_entry_cb_t entry_cb;
+	od_scan_done_cb_t done_cb;
+	void *priv;
+	volatile size_t nodes_done;
+};
+
+int od_scan_start(od_scan_t *s, CO_sdo_async_t *engine, const od_scan_plan_t *plan,
+				  const uint8_t *node_ids, size_t node_cnt, uint32_t timeout_ms,
+				  od_scan_entry_cb_t entry_cb, od_scan_done_cb_t done_cb, void *priv);
+bool od_scan_done(const od_scan_t *s);
+float od_scan_progress(const od_scan_t *s);
+// After od_scan_done() only
+void od_scan_free(od_scan_t *s);
+
+#endif // OD_SCAN_H__
@@ -0,0 +1,88 @@
+#include "od_store.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define OD_STORE_ALIGN(x) (((x) + (sizeof(od_rec_t) - 1)) & ~(sizeof(od_rec_t) - 1)) // keeps headers aligned
+#define OD_STORE_MIN_CAP 4096
+
+#define NO_ENTRY ((size_t)-1)
+
+static int reserve(od_store_t *s, size_t end)
+{
+	if(end <= s->cap) return 0;
+	size_t cap = s->cap ? s->cap : OD_STORE_MIN_CAP;
+	while(cap < end) cap *= 2;
+	uint8_t *mem = realloc(s->mem, cap);
+	if(!mem) return 1;
+	s->mem = mem;
+	s->cap = cap;
+	return 0;
+}
+
+void od_store_init(od_store_t *s)
+{
+	memset(s, 0, sizeof(*s));
+	s->open = NO_ENTRY;
+}
+
+void od_store_free(od_store_t *s)
+{
+	free(s->mem);
+	od_store_init(s);
+}
+
+int od_store_begin(od_store_t *s, uint16_t index, uint8_t sub_index)
+{
+	od_store_drop(s);
+	if(reserve(s, s->len + sizeof(od_rec_t))) return 1;
+	od_rec_t *r = (od_rec_t *)(s->mem + s->len);
+	r->index = index;
+	r->sub_index = sub_index;
+	r->size = 0;
+	s->open = s->len;
+	s->len += sizeof(od_rec_t);
+	return 0;
+}
+
+size_t od_store_sink(void *priv, size_t offset, const uint8_t *data, size_t len)
+{
+	od_store_t *s = priv;
+	if(s->open == NO_ENTRY || offset + len > UINT32_MAX) return 0;
+	const size_t at = s->open + sizeof(od_rec_t) + offset; // offset restarts from 0 on a block -> segmented retry
+	if(reserve(s, at + len)) return 0;
+	memcpy(s->mem + at, data, len);
+	((od_rec_t *)(s->mem + s->open))->size = (uint32_t)(offset + len);
+	s->len = at + len;
+	return len;
+}
+
+const od_rec_t *od_store_commit(od_store_t *s)
+{
+	if(s->open == NO_ENTRY) return NULL;
+	const size_t end = s->open + sizeof(od_rec_t) + OD_STORE_ALIGN((size_t)((od_rec_t *)(s->mem + s->open))->size);
+	if(reserve(s, end)) return NULL;
+	od_rec_t *r = (od_rec_t *)(s->mem + s->open);
+	s->len = end;
+	s->open = NO_ENTRY;
+	s->cnt++;
+	return r;
+}
+
+void od_store_drop(od_store_t *s)
+{
+	if(s->open == NO_ENTRY) return;
+	s->len = s->open;
+	s->open = NO_ENTRY;
+}
+
+const od_rec_t *od_store_first(const od_store_t *s)
+{
+	return s->cnt ? (const od_rec_t *)s->mem : NULL;
+}
+
+const od_rec_t *od_store_next(const od_store_t *s, const od_rec_t *r)
+{
+	const size_t off = (size_t)((const uint8_t *)r - s->mem) + sizeof(od_rec_t) + OD_STORE_ALIGN((size_t)r->size);
+	const size_t end = s->open == NO_ENTRY ? s->len : s->open;
+	return off < end ? (const od_rec_t *)(s->mem + off) : NULL;
+}
@@ -0,0 +1,43 @@
+#ifndef OD_STORE_H__
+#define OD_STORE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+// One read entry, followed by 'size' data bytes in the arena
+typedef struct
+{
+	uint16_t index;
+	uint8_t sub_index;
+	uint32_t size;
+} od_rec_t;
+
+/**
+ * Append-only arena with the existing entries only, in scan order.
+ * An entry is opened with od_store_begin(), its data is appended by od_store_sink()
+ * (an SDO stream sink) and it is kept by od_store_commit() or dropped by od_store_drop().
+ * Record pointers are valid until the next od_store_begin() (the arena may move).
+ */
+typedef struct
+{
+	uint8_t *mem;
+	size_t len, cap;
+	size_t open; // offset of the entry being read
+	size_t cnt;
+} od_store_t;
+
+void od_store_init(od_store_t *s);
+void od_store_free(od_store_t *s);
+
+int od_store_begin(od_store_t *s, uint16_t index, uint8_t sub_index);
+size_t od_store_sink(void *priv, size_t offset, const uint8_t *data, size_t len);
+const od_rec_t *od_store_commit(od_store_t *s);
+void od_store_drop(od_store_t *s);
+
+static inline const uint8_t *od_rec_data(const od_rec_t *r) { return (const uint8_t *)(r + 1); }
+
+// Iteration: for(const od_rec_t *r = od_store_first(s); r; r = od_store_next(s, r))
+const od_rec_t *od_store_first(const od_store_t *s);
+const od_rec_t *od_store_next(const od_store_t *s, const od_rec_t *r);
+
+#endif // OD_STORE_H__
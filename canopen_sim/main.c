@@ -0,0 +1,357 @@
+// Simulated CANopen network behind a pty speaking SLCAN: tools open the printed port instead of an adapter.
+// Every node is a CO_t of its own in this process running the full CANopenNode stack on its own pty, with a private
+// copy of the OD from OD_DIR (CO_MULTIPLE_OD, see Makefile). The hub joins all ptys into one bus and injects
+// response delay, jitter and frame loss. With -u the nodes start LSS-unconfigured (node-ID 0xFF, serial number = id)
+// for an LSS master to commission. With -i the nodes join a SocketCAN interface (e.g. vcan0) instead, the kernel is the
+// bus then: no hub, no delay/jitter/loss injection.
+// usage: canopen_sim [-u] [-d delay_us] [-j jitter_us] [-l loss_%] [-r seed] [-b hb_ms] [-L link] [-i ifname] id|first-last...
+// (Linux only)
+#define _GNU_SOURCE
+#include "co_od.h"
+#include "co_wrapper.h"
+#include "slcan.h"
+#include "timedate.h"
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define SIM_NODES_MAX 127
+#define SIM_QUEUE_SIZE 4096 // frames waiting for their delay, must be power of two
+#define SIM_LINE_MAX 64
+
+typedef struct
+{
+	int fd;		  // master side, the hub's end
+	int fd_slave; // kept open so the master doesn't report a hangup while nobody uses the port
+	char name[64];
+	char line[SIM_LINE_MAX];
+	size_t pos;
+	uint8_t node_id; // 0 - the client port
+	OD_t *od;
+	CO_t *co;
+	sp_t sp;		 // the node's end
+	socketcan_t can; // -i
+} sim_port_t;
+
+typedef struct
+{
+	uint64_t due_us;
+	uint8_t src;
+	uint8_t len;
+	char frame[SIM_LINE_MAX];
+} sim_frame_t;
+
+static struct
+{
+	sim_port_t port[SIM_NODES_MAX + 1]; // [0] is the client
+	uint32_t port_cnt;
+	sim_frame_t q[SIM_QUEUE_SIZE];
+	uint32_t head, tail;
+
+	uint32_t delay_us, jitter_us;
+	uint32_t loss; // drop threshold of rnd()
+	uint32_t seed;
+	const char *ifname;
+
+	uint32_t frames, dropped, q_ovf, tx_ovf;
+} sim;
+
+static volatile bool run = true;
+
+static void on_signal(int sig)
+{
+	(void)sig;
+	run = false;
+}
+
+static uint64_t now_us(void)
+{
+	TD_V t;
+	TD_GET(t);
+	return (uint64_t)t.tv_sec * USEC_PER_SEC + (uint64_t)t.tv_nsec / NSEC_PER_USEC;
+}
+
+// xorshift32, reproducible loss pattern for a given seed
+static uint32_t rnd(void)
+{
+	sim.seed ^= sim.seed << 13;
+	sim.seed ^= sim.seed >> 17;
+	sim.seed ^= sim.seed << 5;
+	return sim.seed;
+}
+
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+
+// LSS: the hub has no bit timing and nothing outlives the process, accept both
+static bool_t lss_bit_rate_ok(void *object, uint16_t bitRate)
+{
+	(void)object;
+	(void)bitRate;
+	return true;
+}
+
+static bool_t lss_store(void *object, uint8_t id, uint16_t bitRate)
+{
+	(void)object;
+	(void)id;
+	(void)bitRate;
+	return true;
+}
+
+// One CANopen node on the slave side of its pty, OD values of its own
+static int node_start(sim_port_t *p, uint16_t hb_ms, bool unconfigured)
+{
+	p->od = co_od_clone(OD);
+	if(!p->od) return -1;
+	if(OD_set_u32(OD_find(p->od, 0x1018), 4, p->node_id, true) != ODR_OK) return -1; // distinct LSS addresses
+
+	const co_wrapper_cfg_t cfg = {.node_id = unconfigured ? 0xFF : p->node_id, .baud = 500, .hb_ms = hb_ms, .hb_cons_ms = 2500, .od = p->od};
+	p->can = (socketcan_t)SOCKETCAN_INIT;
+	int sts = sim.ifname ? co_wrapper_init_socketcan(&p->co, &p->can, &cfg) : co_wrapper_init(&p->co, &p->sp, &cfg);
+	if(sts) return sts;
+	CO_LSSslave_initCheckBitRateCallback(p->co->LSSslave, NULL, lss_bit_rate_ok);
+	CO_LSSslave_initCfgStoreCallback(p->co->LSSslave, NULL, lss_store);
+	return sim.ifname ? socketcan_open(&p->can, sim.ifname, p->co->CANmodule) : sp_open(&p->sp, p->name, sp_rx, p->co);
+}
+
+static void node_stop(sim_port_t *p)
+{
+	if(sim.ifname)
+		socketcan_close(&p->can);
+	else
+		sp_close(&p->sp);
+	co_wrapper_deinit(&p->co);
+	co_od_free(p->od);
+	p->od = NULL;
+}
+
+static int port_open(sim_port_t *p)
+{
+	p->fd = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+	if(p->fd < 0 || grantpt(p->fd) || unlockpt(p->fd) || !ptsname(p->fd)) return -1;
+	snprintf(p->name, sizeof(p->name), "%s", ptsname(p->fd));
+	struct termios t;
+	tcgetattr(p->fd, &t);
+	cfmakeraw(&t);
+	tcsetattr(p->fd, TCSANOW, &t);
+	p->fd_slave = open(p->name, O_RDWR | O_NOCTTY | O_NONBLOCK);
+	return p->fd_slave < 0 ? -1 : 0;
+}
+
+static void port_write(sim_port_t *p, const char *buf, size_t len)
+{
+	if(write(p->fd, buf, len) != (ssize_t)len) sim.tx_ovf++; // reader too slow or gone: the frame is lost as on a bus without it
+}
+
+// Frame from port src: into the delay queue, unless the loss injection drops it
+static void frame_in(uint8_t src, const char *line, size_t len)
+{
+	sim.frames++;
+	if(sim.loss && rnd() < sim.loss)
+	{
+		sim.dropped++;
+		return;
+	}
+	if(sim.head - sim.tail >= SIM_QUEUE_SIZE)
+	{
+		sim.q_ovf++;
+		return;
+	}
+	sim_frame_t *f = &sim.q[sim.head & (SIM_QUEUE_SIZE - 1)];
+	f->due_us = now_us();
+	if(src) f->due_us += sim.delay_us + (sim.jitter_us ? rnd() % (sim.jitter_us + 1) : 0); // node responses only
+	// the bus keeps the order: a frame never overtakes the one before it
+	if(sim.head != sim.tail)
+	{
+		const uint64_t prev = sim.q[(sim.head - 1) & (SIM_QUEUE_SIZE - 1)].due_us;
+		if(f->due_us < prev) f->due_us = prev;
+	}
+	f->src = src;
+	f->len = (uint8_t)len;
+	memcpy(f->frame, line, len);
+	f->frame[f->len++] = '\r';
+	sim.head++;
+}
+
+// Everyone else on the bus receives the frame
+static void frame_out(const sim_frame_t *f)
+{
+	for(uint32_t i = 0; i < sim.port_cnt; i++)
+		if(i != f->src) port_write(&sim.port[i], f->frame, f->len);
+}
+
+static void line_in(uint8_t src, const char *line, size_t len)
+{
+	if(!len) return;
+	switch(line[0])
+	{
+	case 't':
+	case 'T':
+	case 'r':
+	case 'R':
+		frame_in(src, line, len);
+		return;
+	default: // adapter command (open, bitrate, timestamps, ...): acknowledged, nothing to configure
+		if(src == 0) port_write(&sim.port[0], "\r", 1);
+		return;
+	}
+}
+
+static void port_read(uint8_t idx)
+{
+	sim_port_t *p = &sim.port[idx];
+	char buf[4096];
+	ssize_t len = read(p->fd, buf, sizeof(buf));
+	for(ssize_t i = 0; i < len; i++)
+	{
+		if(buf[i] == '\r' || buf[i] == '\n')
+		{
+			line_in(idx, p->line, p->pos);
+			p->pos = 0;
+		}
+		else if(p->pos < sizeof(p->line) - 2) // room for '\r'
+			p->line[p->pos++] = buf[i];
+	}
+}
+
+static int parse_ids(int argc, char **argv, int first, bool *ids)
+{
+	int cnt = 0;
+	for(int i = first; i < argc; i++)
+	{
+		char *end;
+		long lo = strtol(argv[i], &end, 0), hi = lo;
+		if(*end == '-') hi = strtol(end + 1, &end, 0);
+		if(*end || lo < 1 || hi > SIM_NODES_MAX || lo > hi) return -1;
+		for(long id = lo; id <= hi; id++) cnt += ids[id] ? 0 : 1, ids[id] = true;
+	}
+	return cnt;
+}
+
+int main(int argc, char **argv)
+{
+	const char *link = NULL;
+	uint16_t hb_ms = 1000;
+	bool unconfigured = false;
+	double loss = 0;
+	sim.seed = 1;
+
+	int i = 1;
+	for(; i < argc && argv[i][0] == '-' && argv[i][1]; i++)
+	{
+		if(argv[i][1] == 'u')
+		{
+			unconfigured = true;
+			continue;
+		}
+		if(i + 1 >= argc) break;
+		const char *v = argv[++i];
+		switch(argv[i - 1][1])
+		{
+		case 'd': sim.delay_us = (uint32_t)atol(v); break;
+		case 'j': sim.jitter_us = (uint32_t)atol(v); break;
+		case 'l': loss = atof(v); break;
+		case 'r': sim.seed = (uint32_t)atol(v) ? (uint32_t)atol(v) : 1; break;
+		case 'b': hb_ms = (uint16_t)atoi(v); break;
+		case 'L': link = v; break;
+		case 'i': sim.ifname = v; break;
+		default: i = argc; break;
+		}
+	}
+	bool ids[SIM_NODES_MAX + 1] = {0};
+	if(i >= argc || parse_ids(argc, argv, i, ids) <= 0 || loss < 0 || loss > 100)
+	{
+		printf("usage: %s [-u] [-d delay_us] [-j jitter_us] [-l loss_%%] [-r seed] [-b hb_ms] [-L link] [-i ifname] id|first-last...\n", argv[0]);
+		return 1;
+	}
+	sim.loss = (uint32_t)(loss / 100.0 * 4294967295.0);
+	if(sim.ifname) link = NULL; // no client pty
+
+	// the node threads leave the signals to ppoll() below
+	sigset_t sig_block, sig_orig;
+	sigemptyset(&sig_block);
+	sigaddset(&sig_block, SIGINT);
+	sigaddset(&sig_block, SIGTERM);
+	pthread_sigmask(SIG_BLOCK, &sig_block, &sig_orig);
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+
+	sim.port_cnt = 1;
+	for(uint8_t id = 1; id <= SIM_NODES_MAX && run; id++)
+	{
+		if(!ids[id]) continue;
+		sim_port_t *p = &sim.port[sim.port_cnt];
+		p->node_id = id;
+		if(!sim.ifname && port_open(p))
+		{
+			perror("pty");
+			break;
+		}
+		sim.port_cnt++;
+		const int sts = node_start(p, hb_ms, unconfigured);
+		if(sts)
+		{
+			fprintf(stderr, "node %u: init failed: %d\n", id, sts);
+			run = false;
+		}
+	}
+	if(!sim.ifname && port_open(&sim.port[0]))
+	{
+		perror("pty");
+		run = false;
+	}
+	if(run && sim.ifname)
+	{
+		printf("SocketCAN %s, %u nodes\n", sim.ifname, sim.port_cnt - 1);
+		fflush(stdout);
+		while(run)
+			sigsuspend(&sig_orig);
+	}
+	if(run && link)
+	{
+		unlink(link);
+		if(symlink(sim.port[0].name, link)) perror("link");
+	}
+	if(run)
+	{
+		printf("SLCAN port %s%s%s, %u nodes, delay %u+%u us, loss %g%% (seed %u)\n", sim.port[0].name, link ? " -> " : "", link ? link : "",
+			   sim.port_cnt - 1, sim.delay_us, sim.jitter_us, loss, sim.seed);
+		fflush(stdout);
+	}
+
+	struct pollfd pfd[SIM_NODES_MAX + 1];
+	while(run)
+	{
+		struct timespec ts, *timeout = NULL; // µs resolution, poll() would round the delay up to whole ms
+		if(sim.head != sim.tail)
+		{
+			const uint64_t now = now_us(), due = sim.q[sim.tail & (SIM_QUEUE_SIZE - 1)].due_us;
+			const uint64_t wait = due > now ? due - now : 0;
+			ts = (struct timespec){.tv_sec = (time_t)(wait / USEC_PER_SEC), .tv_nsec = (long)(wait % USEC_PER_SEC) * NSEC_PER_USEC};
+			timeout = &ts;
+		}
+		for(uint32_t k = 0; k < sim.port_cnt; k++)
+			pfd[k] = (struct pollfd){.fd = sim.port[k].fd, .events = POLLIN};
+		if(ppoll(pfd, sim.port_cnt, timeout, &sig_orig) < 0) continue; // EINTR: run was cleared
+		for(uint32_t k = 0; k < sim.port_cnt; k++)
+			if(pfd[k].revents & POLLIN) port_read((uint8_t)k);
+
+		const uint64_t now = now_us();
+		for(; sim.head != sim.tail && sim.q[sim.tail & (SIM_QUEUE_SIZE - 1)].due_us <= now; sim.tail++)
+			frame_out(&sim.q[sim.tail & (SIM_QUEUE_SIZE - 1)]);
+	}
+
+	for(uint32_t k = 1; k < sim.port_cnt; k++)
+		node_stop(&sim.port[k]);
+	if(link) unlink(link);
+	printf("\nframes %u, dropped %u, queue overflow %u, port overflow %u\n", sim.frames, sim.dropped, sim.q_ovf, sim.tx_ovf);
+	return 0;
+}
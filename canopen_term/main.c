@@ -4,6 +4,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
 
@@ -12,7 +13,12 @@
 static uint8_t last_id = 127;
 
 static void cb_co_hb_started(uint8_t node_id, uint8_t idx, void *priv) { printf("hb_started %d\n", node_id); }
-static void cb_co_hb_to(uint8_t node_id, uint8_t idx, void *priv) { printf("hb to %d: %d\n", node_id, OD_PERSIST_COMM.x1016_consumerHeartbeatTime[idx] & 0xFFFF); }
+static void cb_co_hb_to(uint8_t node_id, uint8_t idx, void *priv)
+{
+	uint16_t ms;
+	if(co_wrapper_hb_cons_ms(priv, idx, &ms)) printf("hb to %d: %d\n", node_id, ms);
+	else printf("hb to %d\n", node_id);
+}
 static void cb_co_hb_rst(uint8_t node_id, uint8_t idx, void *priv) { printf("hb rst %d\n", node_id); }
 static void cb_co_nmt_change(uint8_t node_id, uint8_t idx, CO_NMT_internalState_t NMTstate, void *priv)
 {
@@ -20,7 +26,7 @@ static void cb_co_nmt_change(uint8_t node_id, uint8_t idx, CO_NMT_internalState_
 	last_id = node_id;
 }
 
-static void sp_rx(sp_t *sp, const uint8_t *data, size_t len) { slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
 
 static struct
 {
@@ -48,6 +54,16 @@ static void sp_err(sp_t *sp)
 
 int main(int argc, char *argv[])
 {
+	const char *port = NULL;
+	if(argc == 3 && !strcmp(argv[1], "-p"))
+		port = argv[2];
+	else if(argc != 1)
+	{
+		fprintf(stderr, "Error! Wrong arguments!\nUsage: [-p port]\n"
+						"  -p      - serial port, default: the first adapter found\n");
+		return -1;
+	}
+
 	printf("================\n");
 
 	CO_t *co;
@@ -58,16 +74,19 @@ int main(int argc, char *argv[])
 	while(sp_enumerate(&list))
 		if(strstr(list.info.port, "ttyS") == NULL) printf("\t%s#%s#%s\n", list.info.port, list.info.description, list.info.hardware_id);
 
-	while(sp_enumerate(&list))
-		if(strstr(list.info.hardware_id, PORT_ID) != NULL)
-		{
-			strcat(sp.port_name, list.info.port);
-			printf("Using %s %s %s\n", list.info.port, list.info.description, list.info.hardware_id);
-			sp_enumerate_finish(&list);
-			break;
-		}
-
-	CHK(co_wrapper_init(&co, &sp));
+	if(port)
+		snprintf(sp.port_name, sizeof(sp.port_name), "%s", port);
+	else
+		while(sp_enumerate(&list))
+			if(strstr(list.info.hardware_id, PORT_ID) != NULL)
+			{
+				strcat(sp.port_name, list.info.port);
+				printf("Using %s %s %s\n", list.info.port, list.info.description, list.info.hardware_id);
+				sp_enumerate_finish(&list);
+				break;
+			}
+
+	CHK(co_wrapper_init(&co, &sp, NULL));
 	if(sts) goto FIN;
 
 	for(uint32_t i = 0; i < 127; i++)
@@ -145,6 +145,12 @@ OD_entry_t *OD_find(OD_t *od, uint16_t index) {
         return NULL;
     }
 
+    if (od->lut != NULL) {
+        const uint16_t *page = od->lut->page[index >> 8];
+        uint16_t slot = (page != NULL) ? page[index & 0xFFU] : OD_LUT_NONE;
+        return (slot < od->size) ? &od->list[slot] : NULL;
+    }
+
     uint16_t min = 0;
     uint16_t max = od->size - 1;
 
@@ -361,6 +361,20 @@ typedef struct {
 } OD_entry_t;
 
 
+/** Empty slot of @ref OD_lut_t */
+#define OD_LUT_NONE 0xFFFFU
+
+/**
+ * Direct index of an Object Dictionary for @ref OD_find(): two levels,
+ * page[index >> 8][index & 0xFF] is the position of the entry in OD_t::list.
+ */
+typedef struct {
+    /** Slot tables of 256 list positions or @ref OD_LUT_NONE, NULL for pages
+     * without objects */
+    const uint16_t *page[256];
+} OD_lut_t;
+
+
 /**
  * Object Dictionary
  */
@@ -369,6 +383,8 @@ typedef struct {
     uint16_t size;
     /** List OD entries (table of contents), ordered by index */
     OD_entry_t *list;
+    /** Optional direct index, NULL: @ref OD_find() searches the list */
+    const OD_lut_t *lut;
 } OD_t;
 
 
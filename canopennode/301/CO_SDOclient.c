@@ -52,6 +52,12 @@
 #define CO_CONFIG_SDO_CLI_PST 21
 #endif
 
+/* upper limit of the number of segments per block requested by block upload
+ * (further limited by free buffer space), 1..127 */
+#ifndef CO_CONFIG_SDO_CLI_BLKSIZE
+#define CO_CONFIG_SDO_CLI_BLKSIZE 127
+#endif
+
 
 /*
  * Read received message from CAN module.
@@ -1655,8 +1661,8 @@ CO_SDO_return_t CO_SDOclientUpload(CO_SDOclient_t *SDO_C,
 
             /* calculate number of block segments from free buffer space */
             count = CO_fifo_getSpace(&SDO_C->bufFifo) / 7;
-            if (count > 127) {
-                count = 127;
+            if (count > CO_CONFIG_SDO_CLI_BLKSIZE) {
+                count = CO_CONFIG_SDO_CLI_BLKSIZE;
             }
             else if (count == 0) {
                 abortCode = CO_SDO_AB_OUT_OF_MEM;
@@ -1712,8 +1718,8 @@ CO_SDO_return_t CO_SDOclientUpload(CO_SDOclient_t *SDO_C,
 
                 /* calculate number of block segments from free buffer space */
                 count = CO_fifo_getSpace(&SDO_C->bufFifo) / 7;
-                if (count >= 127) {
-                    count = 127;
+                if (count >= CO_CONFIG_SDO_CLI_BLKSIZE) {
+                    count = CO_CONFIG_SDO_CLI_BLKSIZE;
                 }
                 else if (CO_fifo_getOccupied(&SDO_C->bufFifo) > 0) {
                     /* application must empty data buffer first */
@@ -487,11 +487,16 @@ extern "C" {
  *
  * Possible flags, can be ORed:
  * - CO_CONFIG_STORAGE_ENABLE - Enable data storage
+ * - CO_CONFIG_STORAGE_DIRTY - Track writes into storage entries in a dirty
+ *   bitmap of @ref CO_STORAGE_BLOCK_SIZE byte blocks (write hooks installed
+ *   by @ref CO_storage_track()), @ref CO_storage_eeprom stores only changed
+ *   blocks
  */
 #ifdef CO_DOXYGEN
 #define CO_CONFIG_STORAGE (CO_CONFIG_STORAGE_ENABLE)
 #endif
 #define CO_CONFIG_STORAGE_ENABLE 0x01
+#define CO_CONFIG_STORAGE_DIRTY 0x02
 /** @} */ /* CO_STACK_CONFIG_STORAGE */
 
 
@@ -384,6 +384,23 @@ typedef struct {
     /** Offset of next byte being updated by automatic storage, required with
      * @ref CO_storage_eeprom. */
     size_t offset;
+    /** Dirty bitmap of CO_STORAGE_DIRTY_WORDS(len) words, one bit per
+     * CO_STORAGE_BLOCK_SIZE bytes of data, required with
+     * CO_CONFIG_STORAGE_DIRTY. NULL: the entry isn't tracked. */
+    uint32_t *dirty;
+    /** CRC checksums of CO_STORAGE_BLOCKS(len) blocks of the stored data,
+     * required with CO_CONFIG_STORAGE_DIRTY, @ref CO_storage_eeprom and
+     * tracked entries stored on command. The signature CRC is then taken over
+     * this array instead of the data. */
+    uint16_t *blockCrc;
+    /** End of the block being updated by automatic storage, 0 if none,
+     * required with CO_CONFIG_STORAGE_DIRTY and @ref CO_storage_eeprom. */
+    size_t offsetEnd;
+    /** Bytes written by the last store or automatic update, required with
+     * CO_CONFIG_STORAGE_DIRTY. */
+    size_t writeLast;
+    /** Bytes written since init, required with CO_CONFIG_STORAGE_DIRTY. */
+    uint32_t writeTotal;
     /** Additional target specific parameters, optional. */
     void *additionalParameters;
 } CO_storage_entry_t;
@@ -562,6 +562,9 @@ CO_t *CO_new(CO_config_t *config, uint32_t *heapMemoryUsed) {
 #endif
 #if (CO_CONFIG_LSS) & CO_CONFIG_LSS_MASTER
         co->RX_IDX_LSS_MST = idxRx; idxRx += RX_CNT_LSS_MST;
+#endif
+#ifdef CO_CONFIG_TERM_LISTENER
+        idxRx += CO_RX_CNT_TERM_LISTENER; /* last buffer, see co_term_init() */
 #endif
         co->CNT_ALL_RX_MSGS = idxRx;
 
@@ -593,6 +596,9 @@ CO_t *CO_new(CO_config_t *config, uint32_t *heapMemoryUsed) {
 #endif
 #if (CO_CONFIG_LSS) & CO_CONFIG_LSS_MASTER
         co->TX_IDX_LSS_MST = idxTx; idxTx += TX_CNT_LSS_MST;
+#endif
+#ifdef CO_CONFIG_TERM
+        idxTx += CO_TX_CNT_TERM; /* last buffer, see co_term_init() */
 #endif
         co->CNT_ALL_TX_MSGS = idxTx;
 #endif /* #ifdef CO_MULTIPLE_OD */
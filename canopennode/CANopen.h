@@ -46,6 +46,7 @@
 #include "309/CO_gateway_ascii.h"
 #include "extra/CO_trace.h"
 #include "co_term.h"
+#include "sdo_async.h"
 
 
 #ifdef __cplusplus
@@ -412,6 +413,18 @@ typedef struct {
 #ifdef CO_CONFIG_TERM
    CO_term_t term;
 #endif
+#if (CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+   CO_sdo_async_t sdo_async;
+#endif
+   /* co_wrapper instance state, one set per CO_t */
+   OD_t *od; /**< Object dictionary of this instance */
+   uint8_t activeNodeId; /**< Node-ID since the last communication reset */
+   uint8_t pendingNodeId; /**< Node-ID for the next reset, configurable by LSS slave */
+   uint16_t pendingBitRate; /**< kbit/s for the next reset, configurable by LSS slave */
+   struct co_wrapper_hb_cons *hb_cons; /**< 0x1016 handles of od, see co_wrapper_hb_cons_ms() */
+#ifdef CO_MULTIPLE_OD
+   CO_config_t configOD; /**< Copy of the CO_new() configuration, config points here */
+#endif
 } CO_t;
 
 /**
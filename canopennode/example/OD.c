@@ -25,7 +25,7 @@ OD_ATTR_PERSIST_COMM OD_PERSIST_COMM_t OD_PERSIST_COMM = {
     .x1005_COB_ID_SYNCMessage = 0x00000080,
     .x1006_communicationCyclePeriod = 0x00000000,
     .x1007_synchronousWindowLength = 0x00000000,
-    .x1012_COB_IDTimeStampObject = 0C00000100,
+    .x1012_COB_IDTimeStampObject = 0x00000100,
     .x1014_COB_ID_EMCY = 0x00000080,
     .x1015_inhibitTimeEMCY = 0x0000,
     .x1016_consumerHeartbeatTime_sub0 = 0x08,
@@ -1155,7 +1155,8 @@ static OD_ATTR_OD OD_entry_t ODList[] = {
 
 static OD_t _OD = {
     (sizeof(ODList) / sizeof(ODList[0])) - 1,
-    &ODList[0]
+    &ODList[0],
+    NULL
 };
 
 OD_t *OD = &_OD;
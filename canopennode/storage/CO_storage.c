@@ -24,6 +24,8 @@
 
 #include "storage/CO_storage.h"
 
+#include <string.h>
+
 #if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
 
 /*
@@ -126,6 +128,206 @@ static ODR_t OD_write_1011(OD_stream_t *stream, const void *buf,
 }
 
 
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+/* Set the dirty bits of the blocks of entry overlapping addr..addr+len */
+static void dirtyRange(CO_storage_entry_t *entry, const void *addr, size_t len)
+{
+    const uint8_t *start = (const uint8_t *)addr;
+    const uint8_t *data = (const uint8_t *)entry->addr;
+
+    if (entry->dirty == NULL || len == 0 || start >= data + entry->len
+        || start + len <= data
+    ) {
+        return;
+    }
+
+    size_t first = start > data ? (size_t)(start - data) : 0;
+    size_t last = (size_t)(start + len - data) - 1;
+    if (last >= entry->len) last = entry->len - 1;
+    for (size_t b = first / CO_STORAGE_BLOCK_SIZE;
+         b <= last / CO_STORAGE_BLOCK_SIZE; b++
+    ) {
+        entry->dirty[b / 32] |= (uint32_t)1 << (b % 32);
+    }
+}
+
+/*
+ * Read and write functions of CO_storage_hook_t: the replaced extension gets
+ * its own object for the call.
+ *
+ * For more information see file CO_ODinterface.h, OD_IO_t.
+ */
+static ODR_t OD_read_hook(OD_stream_t *stream, void *buf,
+                          OD_size_t count, OD_size_t *countRead)
+{
+    CO_storage_hook_t *hook = stream->object;
+
+    if (hook->inner->read == NULL) {
+        return ODR_UNSUPP_ACCESS;
+    }
+    stream->object = hook->inner->object;
+    ODR_t returnCode = hook->inner->read(stream, buf, count, countRead);
+    stream->object = hook;
+    return returnCode;
+}
+
+static ODR_t OD_write_hook(OD_stream_t *stream, const void *buf,
+                           OD_size_t count, OD_size_t *countWritten)
+{
+    CO_storage_hook_t *hook = stream->object;
+    ODR_t returnCode;
+
+    if (hook->inner == NULL) {
+        returnCode = OD_writeOriginal(stream, buf, count, countWritten);
+    }
+    else if (hook->inner->write == NULL) {
+        return ODR_UNSUPP_ACCESS;
+    }
+    else {
+        stream->object = hook->inner->object;
+        returnCode = hook->inner->write(stream, buf, count, countWritten);
+        stream->object = hook;
+    }
+
+    if ((returnCode == ODR_OK || returnCode == ODR_PARTIAL)
+        && stream->dataOrig != NULL
+    ) {
+        dirtyRange(hook->entry, stream->dataOrig, stream->dataLength);
+    }
+    return returnCode;
+}
+
+/* Tracked storage entry with data of the OD object, NULL if none */
+static CO_storage_entry_t *entryOfObject(CO_storage_t *storage,
+                                         OD_entry_t *odEntry)
+{
+    uint8_t found = 0;
+
+    /* sub-indexes of records may have gaps */
+    for (uint16_t sub = 0; sub <= 0xFF && found < odEntry->subEntriesCount;
+         sub++
+    ) {
+        OD_IO_t io;
+        if (OD_getSub(odEntry, (uint8_t)sub, &io, true) != ODR_OK) {
+            continue;
+        }
+        found++;
+        const uint8_t *data = (const uint8_t *)io.stream.dataOrig;
+        if (data == NULL) {
+            continue;
+        }
+        for (uint8_t i = 0; i < storage->entriesCount; i++) {
+            CO_storage_entry_t *entry = &storage->entries[i];
+            const uint8_t *addr = (const uint8_t *)entry->addr;
+            if (entry->dirty != NULL && data >= addr
+                && data < addr + entry->len
+            ) {
+                return entry;
+            }
+        }
+    }
+    return NULL;
+}
+
+CO_ReturnError_t CO_storage_track(CO_storage_t *storage,
+                                  OD_t *od,
+                                  CO_storage_hook_t *hooks,
+                                  uint16_t hooksCount)
+{
+    /* verify arguments */
+    if (storage == NULL || od == NULL || (hooks == NULL && hooksCount > 0)) {
+        return CO_ERROR_ILLEGAL_ARGUMENT;
+    }
+
+    if (hooks != storage->hooks) {
+        CO_storage_untrack(storage);
+        memset(hooks, 0, hooksCount * sizeof(hooks[0]));
+        storage->hooks = hooks;
+        storage->hooksCount = hooksCount;
+    }
+    /* hooks replaced by other extensions since the last call are free */
+    for (uint16_t i = 0; i < hooksCount; i++) {
+        CO_storage_hook_t *hook = &hooks[i];
+        if (hook->odEntry != NULL
+            && hook->odEntry->extension != &hook->extension
+        ) {
+            hook->odEntry = NULL;
+        }
+    }
+
+    CO_ReturnError_t ret = CO_ERROR_NO;
+    uint16_t slot = 0;
+
+    for (uint16_t n = 0; n < od->size; n++) {
+        OD_entry_t *odEntry = &od->list[n];
+        OD_extension_t *ext = odEntry->extension;
+
+        if (ext == &storage->OD_1010_extension
+            || ext == &storage->OD_1011_extension
+            || (ext != NULL && ext->write == OD_write_hook)
+        ) {
+            continue;
+        }
+        CO_storage_entry_t *entry = entryOfObject(storage, odEntry);
+        if (entry == NULL) {
+            continue;
+        }
+
+        while (slot < hooksCount && hooks[slot].odEntry != NULL) slot++;
+        if (slot == hooksCount) {
+            ret = CO_ERROR_OUT_OF_MEMORY;
+            break;
+        }
+
+        CO_storage_hook_t *hook = &hooks[slot];
+        hook->inner = ext;
+        hook->odEntry = odEntry;
+        hook->entry = entry;
+        hook->extension.object = hook;
+        hook->extension.read = ext == NULL ? OD_readOriginal : OD_read_hook;
+        hook->extension.write = OD_write_hook;
+#if OD_FLAGS_PDO_SIZE > 0
+        memset(hook->extension.flagsPDO, 0, sizeof(hook->extension.flagsPDO));
+#endif
+        OD_extension_init(odEntry, &hook->extension);
+    }
+
+    return ret;
+}
+
+void CO_storage_untrack(CO_storage_t *storage) {
+    if (storage == NULL || storage->hooks == NULL) {
+        return;
+    }
+    for (uint16_t i = 0; i < storage->hooksCount; i++) {
+        CO_storage_hook_t *hook = &storage->hooks[i];
+        if (hook->odEntry != NULL
+            && hook->odEntry->extension == &hook->extension
+        ) {
+            OD_extension_init(hook->odEntry, hook->inner);
+        }
+        hook->odEntry = NULL;
+    }
+    storage->hooks = NULL;
+    storage->hooksCount = 0;
+}
+
+void CO_storage_dirty(CO_storage_t *storage, const void *addr, size_t len) {
+    for (uint8_t i = 0; i < storage->entriesCount; i++) {
+        dirtyRange(&storage->entries[i], addr, len);
+    }
+}
+
+void CO_storage_dirtyAll(CO_storage_entry_t *entry) {
+    if (entry->dirty == NULL) {
+        return;
+    }
+    for (size_t b = 0; b < CO_STORAGE_BLOCKS(entry->len); b++) {
+        entry->dirty[b / 32] |= (uint32_t)1 << (b % 32);
+    }
+}
+#endif
+
 CO_ReturnError_t CO_storage_init(CO_storage_t *storage,
                                  CO_CANmodule_t *CANmodule,
                                  OD_entry_t *OD_1010_StoreParameters,
@@ -148,6 +350,10 @@ CO_ReturnError_t CO_storage_init(CO_storage_t *storage,
     storage->restore = restore;
     storage->entries = entries;
     storage->entriesCount = entriesCount;
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+    storage->hooks = NULL;
+    storage->hooksCount = 0;
+#endif
 
     /* configure extensions */
     if (OD_1010_StoreParameters != NULL) {
@@ -85,6 +85,24 @@ extern "C" {
  */
 
 
+#if ((CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY) || defined CO_DOXYGEN
+#ifndef CO_STORAGE_BLOCK_SIZE
+/**
+ * Bytes of entry data per dirty bit, with CO_CONFIG_STORAGE_DIRTY. Smaller
+ * blocks write less after a change and take a larger bitmap. With
+ * @ref CO_storage_eeprom it should divide the eeprom page size, so a block
+ * never spans pages.
+ */
+#define CO_STORAGE_BLOCK_SIZE 32
+#endif
+
+/** Blocks of an entry of len bytes */
+#define CO_STORAGE_BLOCKS(len) \
+    (((len) + CO_STORAGE_BLOCK_SIZE - 1) / CO_STORAGE_BLOCK_SIZE)
+/** uint32_t words of the dirty bitmap of an entry of len bytes */
+#define CO_STORAGE_DIRTY_WORDS(len) ((CO_STORAGE_BLOCKS(len) + 31) / 32)
+#endif
+
 /**
  * Attributes (bit masks) for Data storage object.
  */
@@ -115,9 +133,30 @@ typedef struct {
     uint8_t entriesCount; /**< From CO_storage_init() */
     bool_t enabled; /**< true, if storage is enabled. Setting of this variable
     is implementation specific. */
+#if ((CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY) || defined CO_DOXYGEN
+    struct CO_storage_hook *hooks; /**< From CO_storage_track() */
+    uint16_t hooksCount; /**< From CO_storage_track() */
+#endif
 } CO_storage_t;
 
 
+#if ((CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY) || defined CO_DOXYGEN
+/**
+ * Write hook of one OD object, which has data inside a tracked storage entry.
+ *
+ * Installed by @ref CO_storage_track() as the extension of the OD object. It
+ * passes reads and writes to the extension it replaced (or to the original
+ * OD data) and marks the written sub-object dirty.
+ */
+typedef struct CO_storage_hook {
+    OD_extension_t extension; /**< Extension installed on the OD object */
+    OD_extension_t *inner; /**< Extension it replaced, NULL if none */
+    OD_entry_t *odEntry; /**< OD object, NULL if the hook is free */
+    CO_storage_entry_t *entry; /**< Storage entry with the data */
+} CO_storage_hook_t;
+#endif
+
+
 /**
  * Initialize data storage object
  *
@@ -158,6 +197,67 @@ CO_ReturnError_t CO_storage_init(CO_storage_t *storage,
                                  CO_storage_entry_t *entries,
                                  uint8_t entriesCount);
 
+#if ((CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY) || defined CO_DOXYGEN
+/**
+ * Track writes into the entries of the storage, which have a dirty bitmap
+ *
+ * Installs a @ref CO_storage_hook_t on each OD object with data inside such
+ * entry, so writes by SDO, RPDO, the OD_set_* helpers and co_od handles mark
+ * the changed blocks. Objects of the storage itself (1010, 1011) are skipped.
+ *
+ * Function must be called after @ref CO_storage_init() and after each function,
+ * which installs OD extensions: after CO_CANopenInit() (also after
+ * communication reset) and again after CO_CANopenInitPDO(), so RPDOs map the
+ * hooked objects and the PDO parameters are tracked too. Hooks, which are still
+ * installed, stay in place; hooks replaced by other extensions are reused.
+ *
+ * @param storage This object was initialized before.
+ * @param od Object Dictionary.
+ * @param hooks Array of hooks, one per tracked OD object. Must exist until
+ * @ref CO_storage_untrack().
+ * @param hooksCount Size of the array.
+ *
+ * @return CO_ERROR_NO, CO_ERROR_ILLEGAL_ARGUMENT or CO_ERROR_OUT_OF_MEMORY, if
+ * hooks are too few: the rest of the objects isn't tracked.
+ */
+CO_ReturnError_t CO_storage_track(CO_storage_t *storage,
+                                  OD_t *od,
+                                  CO_storage_hook_t *hooks,
+                                  uint16_t hooksCount);
+
+/**
+ * Remove the hooks of @ref CO_storage_track() from the OD objects
+ *
+ * Objects get back the extensions they had. Call it before the storage or the
+ * hooks are freed and before @ref CO_storage_init() of a tracked storage, while
+ * the OD still exists.
+ *
+ * @param storage This object.
+ */
+void CO_storage_untrack(CO_storage_t *storage);
+
+/**
+ * Mark data as changed in the tracked entries of the storage
+ *
+ * Sets the dirty bits of the blocks overlapping addr..addr+len. Application,
+ * which writes OD variables of a storage group directly, bypassing the OD
+ * interface, must call it. Call it inside @ref CO_LOCK_OD(), like any access to
+ * the OD variables.
+ *
+ * @param storage This object.
+ * @param addr Start of the changed data.
+ * @param len Length of the changed data.
+ */
+void CO_storage_dirty(CO_storage_t *storage, const void *addr, size_t len);
+
+/**
+ * Mark all blocks of the entry as changed, see @ref CO_storage_dirty().
+ *
+ * @param entry Storage entry with a dirty bitmap.
+ */
+void CO_storage_dirtyAll(CO_storage_entry_t *entry);
+#endif
+
 /** @} */ /* CO_storage */
 
 #ifdef __cplusplus
@@ -26,14 +26,74 @@
 #include "storage/CO_eeprom.h"
 #include "301/crc16-ccitt.h"
 
+#include <string.h>
+
 #if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_ENABLE
 
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+/* Length of block b of the entry */
+static size_t blockLen(CO_storage_entry_t *entry, size_t b) {
+    size_t offset = b * CO_STORAGE_BLOCK_SIZE;
+    return entry->len - offset < CO_STORAGE_BLOCK_SIZE ?
+           entry->len - offset : CO_STORAGE_BLOCK_SIZE;
+}
+
+/* Signature CRC of a tracked entry, taken over the CRCs of its blocks */
+static uint16_t blocksCrc(CO_storage_entry_t *entry) {
+    return crc16_ccitt((uint8_t *)entry->blockCrc,
+                       CO_STORAGE_BLOCKS(entry->len) * sizeof(uint16_t), 0);
+}
+
 /*
- * Function for writing data on "Store parameters" command - OD object 1010
- *
- * For more information see file CO_storage.h, CO_storage_entry_t.
+ * Write and verify the dirty blocks of a tracked entry, update their CRCs.
+ * Block, which fails, stays dirty.
  */
-static ODR_t storeEeprom(CO_storage_entry_t *entry, CO_CANmodule_t *CANmodule) {
+static bool_t storeEepromDirty(CO_storage_entry_t *entry,
+                               CO_CANmodule_t *CANmodule)
+{
+    (void) CANmodule; /* CO_LOCK_OD() only */
+    for (size_t b = 0; b < CO_STORAGE_BLOCKS(entry->len); b++) {
+        uint32_t *word = &entry->dirty[b / 32];
+        uint32_t bit = (uint32_t)1 << (b % 32);
+
+        if (*word == 0) {
+            b |= 31; /* rest of the word is clean */
+            continue;
+        }
+        if ((*word & bit) == 0) {
+            continue;
+        }
+
+        size_t offset = b * CO_STORAGE_BLOCK_SIZE;
+        size_t len = blockLen(entry, b);
+        uint8_t *data = (uint8_t *)entry->addr + offset;
+
+        CO_LOCK_OD(CANmodule);
+        *word &= ~bit;
+        bool_t writeOk = CO_eeprom_writeBlock(entry->storageModule, data,
+                                              entry->eepromAddr + offset, len);
+        entry->blockCrc[b] = crc16_ccitt(data, len, 0);
+        CO_UNLOCK_OD(CANmodule);
+
+        uint16_t crc_read = CO_eeprom_getCrcBlock(entry->storageModule,
+                                                  entry->eepromAddr + offset,
+                                                  len);
+        if (entry->blockCrc[b] != crc_read || !writeOk) {
+            *word |= bit;
+            return false;
+        }
+        entry->writeLast += len;
+    }
+    return true;
+}
+#endif
+
+
+/* Write and verify all data of the entry */
+static bool_t storeEepromAll(CO_storage_entry_t *entry,
+                             CO_CANmodule_t *CANmodule)
+{
+    (void) CANmodule; /* CO_LOCK_OD() only */
     bool_t writeOk;
 
     /* save data to the eeprom */
@@ -46,13 +106,53 @@ static ODR_t storeEeprom(CO_storage_entry_t *entry, CO_CANmodule_t *CANmodule) {
     /* Verify, if data in eeprom are equal */
     uint16_t crc_read = CO_eeprom_getCrcBlock(entry->storageModule,
                                               entry->eepromAddr, entry->len);
-    if (entry->crc != crc_read || !writeOk) {
+    return entry->crc == crc_read && writeOk;
+}
+
+
+/*
+ * Function for writing data on "Store parameters" command - OD object 1010
+ *
+ * For more information see file CO_storage.h, CO_storage_entry_t.
+ */
+static ODR_t storeEeprom(CO_storage_entry_t *entry, CO_CANmodule_t *CANmodule) {
+    bool_t writeOk;
+
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+    entry->writeLast = 0;
+    if (entry->dirty != NULL) {
+        /* save changed blocks only */
+        writeOk = storeEepromDirty(entry, CANmodule);
+        if (writeOk) entry->crc = blocksCrc(entry);
+    }
+    else {
+        writeOk = storeEepromAll(entry, CANmodule);
+        if (writeOk) entry->writeLast = entry->len;
+    }
+    entry->writeTotal += (uint32_t)entry->writeLast;
+#else
+    writeOk = storeEepromAll(entry, CANmodule);
+#endif
+    if (!writeOk) {
         return ODR_HW;
     }
 
     /* Write signature (see CO_storageEeprom_init() for info) */
     uint16_t signatureOfEntry = (uint16_t)entry->len;
     uint32_t signature = (((uint32_t)entry->crc) << 16) | signatureOfEntry;
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+    /* unchanged signature (nothing to store) is not written again */
+    uint32_t signatureStored;
+    CO_eeprom_readBlock(entry->storageModule,
+                        (uint8_t *)&signatureStored,
+                        entry->eepromAddrSignature,
+                        sizeof(signatureStored));
+    if (signatureStored == signature) {
+        return ODR_OK;
+    }
+    entry->writeLast += sizeof(signature);
+    entry->writeTotal += (uint32_t)sizeof(signature);
+#endif
     writeOk = CO_eeprom_writeBlock(entry->storageModule,
                                    (uint8_t *)&signature,
                                    entry->eepromAddrSignature,
@@ -167,6 +267,18 @@ CO_ReturnError_t CO_storageEeprom_init(CO_storage_t *storage,
             *storageInitError = i;
             return CO_ERROR_ILLEGAL_ARGUMENT;
         }
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+        bool_t isTracked = entry->dirty != NULL;
+        if (isTracked && (entry->attr & CO_storage_cmd) != 0
+            && entry->blockCrc == NULL
+        ) {
+            *storageInitError = i;
+            return CO_ERROR_ILLEGAL_ARGUMENT;
+        }
+        entry->offsetEnd = 0;
+        entry->writeLast = 0;
+        entry->writeTotal = 0;
+#endif
 
         /* calculate addresses inside eeprom */
         entry->eepromAddrSignature = signaturesAddress + sizeof(uint32_t) * i;
@@ -202,13 +314,36 @@ CO_ReturnError_t CO_storageEeprom_init(CO_storage_t *storage,
 
             /* Verify CRC, except for auto storage variables */
             if (!isAuto) {
-                uint16_t crc = crc16_ccitt(entry->addr, entry->len, 0);
+                uint16_t crc;
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+                if (isTracked) {
+                    for (size_t b = 0; b < CO_STORAGE_BLOCKS(entry->len); b++){
+                        entry->blockCrc[b] = crc16_ccitt(
+                            (uint8_t *)entry->addr + b * CO_STORAGE_BLOCK_SIZE,
+                            blockLen(entry, b), 0);
+                    }
+                    crc = blocksCrc(entry);
+                }
+                else
+#endif
+                crc = crc16_ccitt(entry->addr, entry->len, 0);
                 if (crc != entry->crc) {
                     dataCorrupt = true;
                 }
             }
         }
 
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+        /* data equals the eeprom, else all of it is to be stored */
+        if (isTracked) {
+            memset(entry->dirty, 0,
+                   CO_STORAGE_DIRTY_WORDS(entry->len) * sizeof(uint32_t));
+            if (dataCorrupt) {
+                CO_storage_dirtyAll(entry);
+            }
+        }
+#endif
+
         /* additional info in case of error */
         if (dataCorrupt) {
             uint32_t errorBit = entry->subIndexOD;
@@ -223,6 +358,70 @@ CO_ReturnError_t CO_storageEeprom_init(CO_storage_t *storage,
 }
 
 
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+/* First dirty block of the entry, marked clean, or false if none */
+static bool_t takeDirty(CO_storage_entry_t *entry, CO_CANmodule_t *CANmodule,
+                        size_t *block)
+{
+    (void) CANmodule; /* CO_LOCK_OD() only */
+    for (size_t w = 0; w < CO_STORAGE_DIRTY_WORDS(entry->len); w++) {
+        if (entry->dirty[w] == 0) {
+            continue;
+        }
+        CO_LOCK_OD(CANmodule);
+        uint32_t bits = entry->dirty[w];
+        uint8_t b = 0;
+        while ((bits & ((uint32_t)1 << b)) == 0) b++;
+        entry->dirty[w] &= ~((uint32_t)1 << b);
+        CO_UNLOCK_OD(CANmodule);
+        *block = w * 32 + b;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Automatic update of a tracked entry: dirty blocks only, byte by byte. One
+ * block per call or until eeprom is busy, all blocks with saveAll.
+ */
+static void autoProcessDirty(CO_storage_entry_t *entry,
+                             CO_CANmodule_t *CANmodule, bool_t saveAll)
+{
+    size_t written = 0;
+
+    for (;;) {
+        if (entry->offsetEnd == 0) {
+            size_t b;
+            if (!takeDirty(entry, CANmodule, &b)) {
+                break;
+            }
+            entry->offset = b * CO_STORAGE_BLOCK_SIZE;
+            entry->offsetEnd = entry->offset + blockLen(entry, b);
+        }
+
+        uint8_t dataByteToUpdate = ((uint8_t *)(entry->addr))[entry->offset];
+        size_t eepromAddr = entry->eepromAddr + entry->offset;
+        if (!CO_eeprom_updateByte(entry->storageModule, dataByteToUpdate,
+                                  eepromAddr)
+        ) {
+            if (saveAll) continue; /* wait, like the untracked saveAll */
+            break;
+        }
+        written++;
+        if (++entry->offset >= entry->offsetEnd) {
+            entry->offsetEnd = 0;
+            if (!saveAll) break;
+        }
+    }
+
+    if (written > 0) {
+        entry->writeLast = written;
+        entry->writeTotal += (uint32_t)written;
+    }
+}
+#endif
+
+
 /******************************************************************************/
 void CO_storageEeprom_auto_process(CO_storage_t *storage, bool_t saveAll) {
     /* verify arguments */
@@ -237,16 +436,23 @@ void CO_storageEeprom_auto_process(CO_storage_t *storage, bool_t saveAll) {
         if ((entry->attr & CO_storage_auto) == 0)
             continue;
 
+#if (CO_CONFIG_STORAGE) & CO_CONFIG_STORAGE_DIRTY
+        if (entry->dirty != NULL) {
+            autoProcessDirty(entry, storage->CANmodule, saveAll);
+            continue;
+        }
+#endif
+
         if (saveAll) {
             /* update all bytes */
-            for (size_t i = 0; i < entry->len; ) {
-                uint8_t dataByteToUpdate = ((uint8_t *)(entry->addr))[i];
-                size_t eepromAddr = entry->eepromAddr + i;
+            for (size_t j = 0; j < entry->len; ) {
+                uint8_t dataByteToUpdate = ((uint8_t *)(entry->addr))[j];
+                size_t eepromAddr = entry->eepromAddr + j;
                 if (CO_eeprom_updateByte(entry->storageModule,
                                          dataByteToUpdate,
                                          eepromAddr)
                 ) {
-                    i++;
+                    j++;
                 }
             }
         }
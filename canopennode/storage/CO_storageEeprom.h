@@ -70,6 +70,14 @@ extern "C" {
  * are stored into write unprotected location. For auto storage to work,
  * its signature in eeprom must be correct. CRC checksum for the data is not
  * used.
+ *
+ * With CO_CONFIG_STORAGE_DIRTY, entries with a dirty bitmap
+ * (CO_storage_entry_t::dirty) are tracked in blocks of CO_STORAGE_BLOCK_SIZE
+ * bytes, see @ref CO_storage_track(). Store command writes and verifies only
+ * the changed blocks, signature CRC is then taken over the CRCs of the blocks
+ * (CO_storage_entry_t::blockCrc), so data stored without tracking is reported
+ * corrupt once. Automatic storage updates only the changed blocks. Bytes
+ * written are counted in CO_storage_entry_t::writeLast and writeTotal.
  */
 
 
@@ -115,7 +123,8 @@ CO_ReturnError_t CO_storageEeprom_init(CO_storage_t *storage,
 /**
  * Automatically update data if differs inside eeprom.
  *
- * Should be called cyclically by program. Each interval it updates one byte.
+ * Should be called cyclically by program. Each interval it updates one byte,
+ * or one changed block of a tracked entry (until eeprom is busy).
  *
  * @param storage This object
  * @param saveAll If true, all bytes are updated, useful on program end.
@@ -3,51 +3,95 @@
 #include "slcan.h"
 #include "sp.h"
 
+#include <stdlib.h>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 void CO_CANsetConfigurationMode(void *CANptr) {}
 
-void CO_CANsetNormalMode(CO_CANmodule_t *CANmodule) { CANmodule->CANnormal = true; }
+void CO_CANsetNormalMode(CO_CANmodule_t *CANmodule)
+{
+	CANmodule->CANnormal = true;
+	if(CANmodule->drv->rx_filter) CANmodule->drv->rx_filter(CANmodule);
+}
 
-int CO_rx(void *priv, can_msg_t *msg);
-int CO_rx(void *priv, can_msg_t *msg)
+static void rx_dispatch(CO_CANmodule_t *can_module, can_msg_t *msg)
 {
 #ifdef CO_FRAME_RX_CB
-	cb_co_frame_rx(priv, msg);
+	cb_co_frame_rx(can_module, msg);
 #endif
-	if(msg->IDE || msg->RTR) return -1;
+	if(msg->IDE || msg->RTR) return;
 
 	// printf(">x%x %d\n", msg->id.std, msg->DLC);
 
-	CO_CANmodule_t *can_module = (CO_CANmodule_t *)priv;
-	CO_CANrx_t *buffer = NULL; /* receive message buffer from CO_CANmodule_t object. */
-	bool_t msgMatched = false;
-
 	CO_CANrx_t rcv_msg = {.ident = msg->id.std, .DLC = msg->DLC};
 	memcpy(rcv_msg.data, msg->data, msg->DLC);
 
-	// CAN module filters are not used, message with any standard 11-bit identifier
-	// has been received. Search rxArray form CANmodule for the same CAN-ID
-	buffer = &can_module->rxArray[0];
-	uint16_t index;
-	for(index = can_module->rxSize; index > 0U; index--)
+	const uint16_t lut = can_module->rx_lut[rcv_msg.ident & (CO_CAN_RX_LUT_SIZE - 1)];
+	if(lut < can_module->rxSize)
+	{
+		CO_CANrx_t *buffer = &can_module->rxArray[lut];
+		if(buffer->CANrx_callback != NULL) buffer->CANrx_callback(buffer->object, (void *)&rcv_msg);
+	}
+	else if(lut == CO_CAN_RX_LUT_SHARED)
 	{
-		if(((rcv_msg.ident ^ buffer->ident) & buffer->mask) == 0U)
+		// Overlapping filters: every buffer with the same CAN-ID gets the frame, like separate hardware filters would.
+		// An idle SDO client left on a node's COB-ID must not swallow the responses for the client currently talking to it.
+		CO_CANrx_t *buffer = &can_module->rxArray[0];
+		for(uint16_t index = can_module->rxSize; index > 0U; index--, buffer++)
 		{
-			msgMatched = true;
-			break;
+			if(buffer->CANrx_callback != NULL && ((rcv_msg.ident ^ buffer->ident) & buffer->mask) == 0U) buffer->CANrx_callback(buffer->object, (void *)&rcv_msg);
 		}
-		buffer++;
 	}
+	else
+		can_module->rx_unmatched++;
+}
 
-	if(msgMatched && (buffer != NULL) && (buffer->CANrx_callback != NULL)) buffer->CANrx_callback(buffer->object, (void *)&rcv_msg);
+int CO_rx(void *priv, can_msg_t *msg)
+{
+	CO_CANmodule_t *can_module = (CO_CANmodule_t *)priv;
+	const uint32_t head = can_module->rxq.head;
+	if(head - __atomic_load_n(&can_module->rxq.tail, __ATOMIC_ACQUIRE) >= CO_CAN_RX_QUEUE_SIZE)
+	{
+		can_module->rx_ovf++;
+		return -1;
+	}
+	can_module->rxq.buf[head & (CO_CAN_RX_QUEUE_SIZE - 1)] = *msg;
+	__atomic_store_n(&can_module->rxq.head, head + 1, __ATOMIC_RELEASE);
 	return 0;
 }
 
+void CO_CANmodule_wakeup(CO_CANmodule_t *CANmodule)
+{
+#if defined(_WIN32)
+	if(CANmodule->thr_evt) SetEvent(CANmodule->thr_evt);
+#else
+	if(CANmodule->thr_evt < 0) return;
+	uint64_t v = 1;
+	ssize_t r = write(CANmodule->thr_evt, &v, sizeof(v)); // counter saturation (EAGAIN) means wakeup is already pending
+	(void)r;
+#endif
+}
+
 CO_ReturnError_t CO_CANmodule_init(CO_CANmodule_t *CANmodule, void *CANptr, CO_CANrx_t rxArray[], uint16_t rxSize,
 								   CO_CANtx_t txArray[], uint16_t txSize, uint16_t can_bitrate)
 {
 	if(CANmodule == NULL || rxArray == NULL || txArray == NULL) return CO_ERROR_ILLEGAL_ARGUMENT;
 
-	CANmodule->CANptr = CANptr; // sp_t
+	uint32_t q_size = (uint32_t)txSize * CO_CAN_TX_QUEUE_PER_BUF;
+	if(q_size > UINT16_MAX) q_size = UINT16_MAX; // tx.cnt and the heap indexes are 16 bit
+	if(CANmodule->tx.size < q_size)
+	{
+		free(CANmodule->tx.q);
+		CANmodule->tx.size = 0U;
+		CANmodule->tx.q = calloc(q_size, sizeof(*CANmodule->tx.q));
+		if(CANmodule->tx.q == NULL) return CO_ERROR_OUT_OF_MEMORY;
+		CANmodule->tx.size = (uint16_t)q_size;
+	}
+
+	CANmodule->CANptr = CANptr; // sp_t or socketcan_t, see CANmodule->drv
 	CANmodule->rxArray = rxArray;
 	CANmodule->rxSize = rxSize;
 	CANmodule->txArray = txArray;
@@ -59,7 +103,13 @@ CO_ReturnError_t CO_CANmodule_init(CO_CANmodule_t *CANmodule, void *CANptr, CO_C
 	CANmodule->firstCANtxMessage = true;
 	CANmodule->CANtxCount = 0U;
 	CANmodule->errOld = 0U;
+	CANmodule->rx_unmatched = 0U;
+	CANmodule->rx_ovf = 0U;
 
+	for(uint16_t i = 0U; i < CO_CAN_RX_LUT_SIZE; i++)
+	{
+		CANmodule->rx_lut[i] = CO_CAN_RX_LUT_NONE;
+	}
 	for(uint16_t i = 0U; i < rxSize; i++)
 	{
 		rxArray[i].ident = 0U;
@@ -71,10 +121,48 @@ CO_ReturnError_t CO_CANmodule_init(CO_CANmodule_t *CANmodule, void *CANptr, CO_C
 	{
 		txArray[i].bufferFull = false;
 	}
+	CANmodule->tx.cnt = 0U;
+	CANmodule->tx.stage_len = 0U;
+	CANmodule->tx.sync_dropped = 0U;
+	CANmodule->tx.flushed = NULL;
+	memset(CANmodule->tx.prio_depth, 0, sizeof(CANmodule->tx.prio_depth));
+	memset(CANmodule->tx.prio_depth_max, 0, sizeof(CANmodule->tx.prio_depth_max));
 	return CO_ERROR_NO;
 }
 
-void CO_CANmodule_disable(CO_CANmodule_t *CANmodule) {}
+void CO_CANmodule_disable(CO_CANmodule_t *CANmodule)
+{
+	if(CANmodule == NULL) return;
+	free(CANmodule->tx.q);
+	CANmodule->tx.q = NULL;
+	CANmodule->tx.size = 0U;
+	CANmodule->tx.cnt = 0U;
+}
+
+/* Recalculate dispatch table entries for all identifiers accepted by ident/mask */
+static void rx_lut_update(CO_CANmodule_t *CANmodule, uint16_t ident, uint16_t mask)
+{
+	const uint16_t free_bits = ~mask & (CO_CAN_RX_LUT_SIZE - 1);
+	const uint16_t base = ident & mask & (CO_CAN_RX_LUT_SIZE - 1);
+	for(uint16_t s = free_bits;; s = (s - 1U) & free_bits)
+	{
+		const uint16_t id = base | s;
+		uint16_t lut = CO_CAN_RX_LUT_NONE;
+		for(uint16_t i = 0U; i < CANmodule->rxSize; i++)
+		{
+			const CO_CANrx_t *buffer = &CANmodule->rxArray[i];
+			if(buffer->CANrx_callback == NULL || ((id ^ buffer->ident) & buffer->mask) != 0U) continue;
+			if(lut != CO_CAN_RX_LUT_NONE)
+			{
+				lut = CO_CAN_RX_LUT_SHARED;
+				break;
+			}
+			lut = i;
+		}
+		CANmodule->rx_lut[id] = lut;
+		if(s == 0U) break;
+	}
+}
 
 CO_ReturnError_t CO_CANrxBufferInit(CO_CANmodule_t *CANmodule, uint16_t index, uint16_t ident, uint16_t mask, bool_t rtr,
 									void *object, void (*CANrx_callback)(void *object, void *message))
@@ -82,11 +170,17 @@ CO_ReturnError_t CO_CANrxBufferInit(CO_CANmodule_t *CANmodule, uint16_t index, u
 	if(CANmodule && object && CANrx_callback && (index < CANmodule->rxSize))
 	{
 		CO_CANrx_t *buffer = &CANmodule->rxArray[index];
+		const bool_t was_used = buffer->CANrx_callback != NULL;
+		const uint16_t ident_old = buffer->ident, mask_old = buffer->mask;
 		buffer->object = object;
 		buffer->CANrx_callback = CANrx_callback;
 		buffer->ident = ident & 0x07FFU;
 		if(rtr) buffer->ident |= 0x0800U;
 		buffer->mask = (mask & 0x07FFU) /* | 0x0800U*/;
+
+		if(was_used && (ident_old != buffer->ident || mask_old != buffer->mask)) rx_lut_update(CANmodule, ident_old, mask_old);
+		rx_lut_update(CANmodule, buffer->ident, buffer->mask);
+		if(CANmodule->CANnormal && CANmodule->drv->rx_filter) CANmodule->drv->rx_filter(CANmodule); // runtime change, e.g. SDO client COB-ID
 		return CO_ERROR_NO;
 	}
 	return CO_ERROR_ILLEGAL_ARGUMENT;
@@ -96,52 +190,143 @@ CO_CANtx_t *CO_CANtxBufferInit(CO_CANmodule_t *CANmodule, uint16_t index, uint16
 {
 	if(CANmodule && (index < CANmodule->txSize))
 	{
+		CO_LOCK_CAN_SEND(CANmodule);
+		if(CANmodule->txArray[index].bufferFull) CANmodule->CANtxCount--; // drop pending frame, stale queue entry is skipped by flush
 		CANmodule->txArray[index].ident = (uint32_t)ident & 0x07FFU;
 		CANmodule->txArray[index].DLC = noOfBytes & 0xFU;
 		CANmodule->txArray[index].bufferFull = false;
 		CANmodule->txArray[index].syncFlag = syncFlag;
+		CO_UNLOCK_CAN_SEND(CANmodule);
 		return &CANmodule->txArray[index];
 	}
 	return NULL;
 }
 
+/* Tx queue is a binary min-heap on COB-ID, so the frame which would win CAN arbitration is sent first */
+static void tx_heap_sift_up(CO_CANmodule_t *CANmodule, uint16_t i)
+{
+	while(i > 0U)
+	{
+		const uint16_t parent = (i - 1U) / 2U;
+		if(CANmodule->tx.q[parent].ident <= CANmodule->tx.q[i].ident) break;
+		const __typeof__(CANmodule->tx.q[0]) t = CANmodule->tx.q[parent];
+		CANmodule->tx.q[parent] = CANmodule->tx.q[i];
+		CANmodule->tx.q[i] = t;
+		i = parent;
+	}
+}
+
+static void tx_heap_sift_down(CO_CANmodule_t *CANmodule, uint16_t i)
+{
+	for(;;)
+	{
+		uint16_t min = i;
+		const uint16_t l = 2U * i + 1U, r = l + 1U;
+		if(l < CANmodule->tx.cnt && CANmodule->tx.q[l].ident < CANmodule->tx.q[min].ident) min = l;
+		if(r < CANmodule->tx.cnt && CANmodule->tx.q[r].ident < CANmodule->tx.q[min].ident) min = r;
+		if(min == i) break;
+		const __typeof__(CANmodule->tx.q[0]) t = CANmodule->tx.q[min];
+		CANmodule->tx.q[min] = CANmodule->tx.q[i];
+		CANmodule->tx.q[i] = t;
+		i = min;
+	}
+}
+
+static void tx_heap_push(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
+{
+	const uint16_t prio = (buffer->ident >> 7) & (CO_CAN_TX_PRIO_CNT - 1);
+	CANmodule->tx.q[CANmodule->tx.cnt].ident = buffer->ident;
+	CANmodule->tx.q[CANmodule->tx.cnt].buffer = buffer;
+	tx_heap_sift_up(CANmodule, CANmodule->tx.cnt++);
+	if(++CANmodule->tx.prio_depth[prio] > CANmodule->tx.prio_depth_max[prio]) CANmodule->tx.prio_depth_max[prio] = CANmodule->tx.prio_depth[prio];
+}
+
+static CO_CANtx_t *tx_heap_remove(CO_CANmodule_t *CANmodule, uint16_t i)
+{
+	CO_CANtx_t *buffer = CANmodule->tx.q[i].buffer;
+	CANmodule->tx.prio_depth[(CANmodule->tx.q[i].ident >> 7) & (CO_CAN_TX_PRIO_CNT - 1)]--;
+	CANmodule->tx.q[i] = CANmodule->tx.q[--CANmodule->tx.cnt];
+	if(i < CANmodule->tx.cnt)
+	{
+		tx_heap_sift_down(CANmodule, i);
+		tx_heap_sift_up(CANmodule, i);
+	}
+	return buffer;
+}
+
+static bool is_processing_thread(CO_CANmodule_t *CANmodule)
+{
+#if defined(_WIN32)
+	return CANmodule->thr_rcv && GetThreadId(CANmodule->thr_rcv) == GetCurrentThreadId();
+#else
+	return pthread_equal(pthread_self(), CANmodule->thr_rcv);
+#endif
+}
+
 CO_ReturnError_t CO_CANsend(CO_CANmodule_t *CANmodule, CO_CANtx_t *buffer)
 {
 	CO_ReturnError_t err = CO_ERROR_NO;
 
+	CO_LOCK_CAN_SEND(CANmodule);
 	if(buffer->bufferFull)
 	{
+		/* frame is still queued, it will be sent with the new data */
 		if(!CANmodule->firstCANtxMessage) CANmodule->CANerrorStatus |= CO_CAN_ERRTX_OVERFLOW; /* don't set error, if bootup message is still on buffers */
 		err = CO_ERROR_TX_OVERFLOW;
 	}
+	else if(CANmodule->tx.cnt < CANmodule->tx.size)
+	{
+		tx_heap_push(CANmodule, buffer);
+		buffer->bufferFull = true;
+		CANmodule->CANtxCount++;
+	}
+	else
+	{
+		CANmodule->CANerrorStatus |= CO_CAN_ERRTX_OVERFLOW;
+		err = CO_ERROR_TX_OVERFLOW;
+	}
+	CO_UNLOCK_CAN_SEND(CANmodule);
 
-	CO_LOCK_CAN_SEND(CANmodule);
-	sp_t *sp = (sp_t *)CANmodule->CANptr;
+	if(!is_processing_thread(CANmodule)) CO_CANmodule_wakeup(CANmodule); // processing thread flushes on its own
+	return err;
+}
 
-	can_msg_t tx_msg = {.id.std = buffer->ident, .DLC = buffer->DLC};
-	memcpy(tx_msg.data, buffer->data, buffer->DLC);
+bool CO_CANmodule_flush(CO_CANmodule_t *CANmodule)
+{
+	/* Port didn't accept everything last time: keep frames queued (bufferFull) until it does */
+	if(CANmodule->drv->tx_pending(CANmodule)) return true;
 
-	slcan_tx(sp, &tx_msg);
-#ifdef CO_FRAME_TX_CB
-	cb_co_frame_tx(sp, &tx_msg);
-#endif
-	CANmodule->firstCANtxMessage = false; // first CAN message (bootup) was sent successfully
-	CANmodule->bufferInhibitFlag = false; // clear flag from previous message
+	can_msg_t msg[CO_CAN_TX_BATCH];
+	size_t n = 0;
 
-	/* if CAN TX buffer is free, copy message to it */
-	// if(can_drv_tx(dev, buffer->ident, buffer->DLC, buffer->data) > 0 && CANmodule->CANtxCount == 0)
-	// {
-	// 	CANmodule->bufferInhibitFlag = buffer->syncFlag;
-	// }
-	// /* if no buffer is free, message will be sent by interrupt */
-	// else
-	// {
-	// 	buffer->bufferFull = true;
-	// 	CANmodule->CANtxCount++;
-	// }
+	CO_LOCK_CAN_SEND(CANmodule);
+	while(CANmodule->tx.cnt && n < CO_CAN_TX_BATCH)
+	{
+		CO_CANtx_t *buffer = tx_heap_remove(CANmodule, 0U);
+		if(!buffer->bufferFull) continue; // re-initialised after it was queued
+
+		msg[n] = (can_msg_t){.id.std = buffer->ident, .DLC = buffer->DLC};
+		memcpy(msg[n].data, buffer->data, buffer->DLC);
+		buffer->bufferFull = false;
+		CANmodule->CANtxCount--;
+		n++;
+	}
+	const bool pending = CANmodule->tx.cnt != 0;
 	CO_UNLOCK_CAN_SEND(CANmodule);
+	if(n == 0) return false;
 
-	return err;
+	const int sts = CANmodule->drv->tx(CANmodule, msg, n);
+	if(sts >= 0)
+	{
+		CANmodule->firstCANtxMessage = false; // first CAN message (bootup) was sent successfully
+		CANmodule->bufferInhibitFlag = false; // clear flag from previous message
+	}
+	if(CANmodule->tx.flushed) CANmodule->tx.flushed(CANmodule);
+#ifdef CO_FRAME_TX_CB
+	for(size_t i = 0; i < n; i++)
+		cb_co_frame_tx(CANmodule->CANptr, &msg[i]);
+#endif
+	return pending || sts > 0;
 }
 
 void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
@@ -149,32 +334,23 @@ void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
 	uint32_t tpdoDeleted = 0U;
 
 	CO_LOCK_CAN_SEND(CANmodule);
-	/* Abort message from CAN module, if there is synchronous TPDO. Take special care with this functionality. */
-	// if(can_drv_is_transmitting(dev) && CANmodule->bufferInhibitFlag)
-	// {
-	// 	/* clear TXREQ */
-	// 	can_drv_tx_abort(dev);
-	// 	CANmodule->bufferInhibitFlag = false; /* clear TXREQ */
-	// 	tpdoDeleted = 1U;
-	// }
-
-	// if(CANmodule->CANtxCount != 0U) // delete also pending synchronous TPDOs in TX buffers
-	// {
-	// 	CO_CANtx_t *buffer = &CANmodule->txArray[0];
-	// 	for(uint16_t i = CANmodule->txSize; i > 0U; i--)
-	// 	{
-	// 		if(buffer->bufferFull)
-	// 		{
-	// 			if(buffer->syncFlag)
-	// 			{
-	// 				buffer->bufferFull = false;
-	// 				CANmodule->CANtxCount--;
-	// 				tpdoDeleted = 2U;
-	// 			}
-	// 		}
-	// 		buffer++;
-	// 	}
-	// }
+	/* Frames already handed to the port are like a message in the CAN controller which won arbitration: they can't be aborted.
+	 * Delete pending synchronous TPDOs from the queue. */
+	for(uint16_t i = 0U; i < CANmodule->tx.cnt;)
+	{
+		CO_CANtx_t *buffer = CANmodule->tx.q[i].buffer;
+		if(buffer->bufferFull && buffer->syncFlag)
+		{
+			tx_heap_remove(CANmodule, i);
+			buffer->bufferFull = false;
+			CANmodule->CANtxCount--;
+			CANmodule->tx.sync_dropped++;
+			tpdoDeleted = 2U;
+			i = 0U; // heap was reordered
+			continue;
+		}
+		i++;
+	}
 	CO_UNLOCK_CAN_SEND(CANmodule);
 
 	if(tpdoDeleted != 0U) CANmodule->CANerrorStatus |= CO_CAN_ERRTX_PDO_LATE;
@@ -183,6 +359,15 @@ void CO_CANclearPendingSyncPDOs(CO_CANmodule_t *CANmodule)
 /* Get error counters from the module. If necessary, function may use different way to determine errors. */
 void CO_CANmodule_process(CO_CANmodule_t *CANmodule)
 {
+	/* Dispatch frames queued by the reader thread since the last pass */
+	const uint32_t head = __atomic_load_n(&CANmodule->rxq.head, __ATOMIC_ACQUIRE);
+	uint32_t tail = CANmodule->rxq.tail;
+	for(; tail != head; tail++)
+	{
+		rx_dispatch(CANmodule, &CANmodule->rxq.buf[tail & (CO_CAN_RX_QUEUE_SIZE - 1)]);
+	}
+	__atomic_store_n(&CANmodule->rxq.tail, tail, __ATOMIC_RELEASE);
+
 	// uint16_t overflow = can_drv_check_bus_off(dev) ? 1 : 0;
 	// uint16_t rxErrors = can_drv_get_rx_error_counter(dev);
 	// uint16_t txErrors = can_drv_get_tx_error_counter(dev);
@@ -5,7 +5,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#define SLCAN_BUFFER_SIZE 200
+#define SLCAN_BUFFER_SIZE 200 // longest accepted SLCAN command, longer ones are dropped
+
+/* Direct COB-ID -> rxArray index dispatch table */
+#define CO_CAN_RX_LUT_SIZE 0x800
+#define CO_CAN_RX_LUT_NONE 0xFFFFU	 // no rx buffer accepts this identifier
+#define CO_CAN_RX_LUT_SHARED 0xFFFEU // several rx buffers overlap, search rxArray
 
 #if defined(_WIN32)
 #include "windows.h"
@@ -13,6 +18,23 @@
 #include <pthread.h>
 #endif
 
+#include "slcan.h"
+
+/* Frames handed over from the reader thread to the processing thread, must be power of two */
+#ifndef CO_CAN_RX_QUEUE_SIZE
+#define CO_CAN_RX_QUEUE_SIZE 256
+#endif
+/* Pending CO_CANtx_t entries per tx buffer, a re-initialised buffer may still be queued (stale entry) */
+#ifndef CO_CAN_TX_QUEUE_PER_BUF
+#define CO_CAN_TX_QUEUE_PER_BUF 2
+#endif
+/* Max frames written to the port by one CO_CANmodule_flush() call */
+#ifndef CO_CAN_TX_BATCH
+#define CO_CAN_TX_BATCH 32
+#endif
+/* Tx queue depth metrics are kept per CANopen function code (COB-ID >> 7) */
+#define CO_CAN_TX_PRIO_CNT 16
+
 /* Basic definitions. If big endian, CO_SWAP_xx macros must swap bytes. */
 #define CO_LITTLE_ENDIAN
 #define CO_SWAP_16(x) x
@@ -53,6 +75,7 @@ typedef struct
 typedef struct
 {
 	void *CANptr; // typeof(sp_t)
+	void *co;	  // CO_t owning the module (co_wrapper), per-bus state of the SDO helpers
 	CO_CANrx_t *rxArray;
 	uint16_t rxSize;
 	CO_CANtx_t *txArray;
@@ -64,21 +87,49 @@ typedef struct
 	volatile bool_t firstCANtxMessage;
 	volatile uint16_t CANtxCount;
 	uint32_t errOld;
-	bool rx_ovf;
+	uint32_t rx_ovf;	   // frames dropped because rx queue was full
+	uint32_t rx_unmatched; // received standard frames not accepted by any rx buffer
+	uint16_t rx_lut[CO_CAN_RX_LUT_SIZE];
+
+	struct // single producer (reader thread), single consumer (CO_CANmodule_process)
+	{
+		can_msg_t buf[CO_CAN_RX_QUEUE_SIZE];
+		uint32_t head, tail;
+	} rxq;
+
+	struct // filled by CO_CANsend() from any thread, written to the port by CO_CANmodule_flush()
+	{
+		struct
+		{
+			uint16_t ident; // copy of buffer->ident at the time it was queued (heap key)
+			CO_CANtx_t *buffer;
+		} *q;		   // binary min-heap, emulates bus arbitration, sized from txSize by CO_CANmodule_init()
+		uint16_t size; // entries allocated in q
+		uint16_t cnt;
+		uint16_t prio_depth[CO_CAN_TX_PRIO_CNT];	 // queued frames per function code
+		uint16_t prio_depth_max[CO_CAN_TX_PRIO_CNT]; // high-water mark of prio_depth
+		uint32_t sync_dropped;						 // synchronous PDOs dropped by CO_CANclearPendingSyncPDOs()
+		uint8_t stage[CO_CAN_TX_BATCH * SLCAN_MAX_FRAME_SIZE]; // encoded bytes not accepted by the port yet (SLCAN)
+		uint16_t stage_len;
+		void (*flushed)(void *object); // frames left the queue, wakes a sender waiting for its CANtxBuff (sdo.c)
+#if defined(_WIN32)
+		CRITICAL_SECTION lock;
+#else
+		pthread_mutex_t lock;
+#endif
+	} tx;
+
+	const struct CO_CANdrv_t *drv; // transport behind CANptr, set before CO_CANinit()
 
 	volatile bool thr_run;
 #if defined(_WIN32)
 	HANDLE thr_rcv;
+	HANDLE thr_evt; // wakes processing thread (auto-reset event)
 #else
 	pthread_t thr_rcv;
 	volatile bool thr_exited;
+	int thr_evt; // wakes processing thread (eventfd), -1 if not used
 #endif
-
-	struct
-	{
-		uint8_t buf[SLCAN_BUFFER_SIZE + 1];
-		int32_t pos;
-	} slcan;
 } CO_CANmodule_t;
 
 /* Data storage object for one entry */
@@ -88,13 +139,30 @@ typedef struct
 	size_t len;
 	uint8_t subIndexOD;
 	uint8_t attr;
+	/* CO_storageEeprom */
+	void *storageModule;
+	uint16_t crc;
+	size_t eepromAddrSignature;
+	size_t eepromAddr;
+	size_t offset;
+	/* CO_CONFIG_STORAGE_DIRTY */
+	uint32_t *dirty;
+	uint16_t *blockCrc;
+	size_t offsetEnd;
+	size_t writeLast;
+	uint32_t writeTotal;
 	/* Additional variables (target specific) */
 	void *addrNV;
 } CO_storage_entry_t;
 
 /* (un)lock critical section in CO_CANsend() */
-#define CO_LOCK_CAN_SEND(CAN_MODULE)
-#define CO_UNLOCK_CAN_SEND(CAN_MODULE)
+#if defined(_WIN32)
+#define CO_LOCK_CAN_SEND(CAN_MODULE) EnterCriticalSection(&(CAN_MODULE)->tx.lock)
+#define CO_UNLOCK_CAN_SEND(CAN_MODULE) LeaveCriticalSection(&(CAN_MODULE)->tx.lock)
+#else
+#define CO_LOCK_CAN_SEND(CAN_MODULE) pthread_mutex_lock(&(CAN_MODULE)->tx.lock)
+#define CO_UNLOCK_CAN_SEND(CAN_MODULE) pthread_mutex_unlock(&(CAN_MODULE)->tx.lock)
+#endif
 
 /* (un)lock critical section in CO_errorReport() or CO_errorReset() */
 #define CO_LOCK_EMCY(CAN_MODULE)
@@ -105,7 +173,7 @@ typedef struct
 #define CO_UNLOCK_OD(CAN_MODULE)
 
 /* Synchronization between CAN receive and message processing threads. */
-#define CO_MemoryBarrier()
+#define CO_MemoryBarrier() __atomic_thread_fence(__ATOMIC_SEQ_CST)
 #define CO_FLAG_READ(rxNew) ((rxNew) != NULL)
 #define CO_FLAG_SET(rxNew)  \
 	{                       \
@@ -118,4 +186,24 @@ typedef struct
 		rxNew = NULL;        \
 	}
 
+/* Transport behind CO_CANmodule_t. Rx side feeds CO_rx() from its own reader, tx side is called from the processing thread */
+typedef struct CO_CANdrv_t
+{
+	bool (*tx_pending)(CO_CANmodule_t *CANmodule);						   // retry output not accepted by the port yet, true while some is left
+	int (*tx)(CO_CANmodule_t *CANmodule, const can_msg_t *msg, size_t cnt); // <0 port error, else amount the port didn't accept yet (kept by the driver)
+	void (*rx_filter)(CO_CANmodule_t *CANmodule);						   // rxArray changed, optional
+} CO_CANdrv_t;
+
+extern const CO_CANdrv_t CO_CANdrv_slcan; // CANptr is sp_t
+#if defined(__linux__)
+extern const CO_CANdrv_t CO_CANdrv_socketcan; // CANptr is socketcan_t
+#endif
+
+/* Queue received frame for the processing thread (reader thread only), returns -1 on overflow */
+int CO_rx(void *priv, can_msg_t *msg);
+/* Wake CANopen processing thread (new frames queued, shutdown, etc.) */
+void CO_CANmodule_wakeup(CO_CANmodule_t *CANmodule);
+/* Write frames queued by CO_CANsend() to the port (processing thread only), returns true if frames are still pending */
+bool CO_CANmodule_flush(CO_CANmodule_t *CANmodule);
+
 #endif // CO_DRIVER_TARGET_H_
@@ -1,7 +1,8 @@
 /*******************************************************************************
     CANopen Object Dictionary definition for CANopenNode V4
 
-    This file was automatically generated by CANopenEditor v4.0-51-g2d9b1ad
+    This file was automatically generated by od_gen (make od) from the
+    CANopenEditor project
 
     https://github.com/CANopenNode/CANopenNode
     https://github.com/CANopenNode/CANopenEditor
@@ -25,345 +26,4536 @@ OD_ATTR_PERSIST_COMM OD_PERSIST_COMM_t OD_PERSIST_COMM = {
     .x1005_COB_ID_SYNCMessage = 0x00000080,
     .x1006_communicationCyclePeriod = 0x00000000,
     .x1007_synchronousWindowLength = 0x00000000,
-    .x1008_manufacturerDeviceName = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    .x1009_manufacturerHardwareVersion = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
-    .x100A_manufacturerSoftwareVersion = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
     .x1012_COB_IDTimeStampObject = 0xC0000100,
     .x1014_COB_ID_EMCY = 0x00000080,
-    .x1015_inhibitTimeEMCY = 0x0000,
-    .x1016_consumerHeartbeatTime_sub0 = 0x7F,
     .x1016_consumerHeartbeatTime = {0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000},
-    .x1017_producerHeartbeatTime = 0x0320,
     .x1018_identity = {
-        .highestSub_indexSupported = 0x07,
         .vendor_ID = 0x53534F46,
         .productCode = 0x00000000,
         .revisionNumber = 0x00000000,
         .serialNumber = 0x00000000,
         .UID0 = 0x00000000,
         .UID1 = 0x00000000,
-        .UID2 = 0x00000000
+        .UID2 = 0x00000000,
+        .highestSub_indexSupported = 0x07
     },
-    .x1019_synchronousCounterOverflowValue = 0x00,
     .x1280_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
         .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x1281_SDOClientParameter = {
         .COB_IDClientToServerTx = 0x80000000,
         .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
         .node_IDOfTheSDOServer = 0x01
     },
-    .x1400_RPDOCommunicationParameter = {
-        .highestSub_indexSupported = 0x05,
-        .COB_IDUsedByRPDO = 0x80000200,
-        .transmissionType = 0xFE,
-        .eventTimer = 0x0000
+    .x1282_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1600_RPDOMappingParameter = {
-        .numberOfMappedApplicationObjectsInPDO = 0x00,
-        .applicationObject_1 = 0x00000000,
-        .applicationObject_2 = 0x00000000,
-        .applicationObject_3 = 0x00000000,
-        .applicationObject_4 = 0x00000000,
-        .applicationObject_5 = 0x00000000,
-        .applicationObject_6 = 0x00000000,
-        .applicationObject_7 = 0x00000000,
-        .applicationObject_8 = 0x00000000
+    .x1283_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1800_TPDOCommunicationParameter = {
-        .highestSub_indexSupported = 0x06,
-        .COB_IDUsedByTPDO = 0xC0000180,
-        .transmissionType = 0xFE,
-        .inhibitTime = 0x0000,
-        .eventTimer = 0x0000,
-        .SYNCStartValue = 0x00
+    .x1284_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1A00_TPDOMappingParameter = {
-        .numberOfMappedApplicationObjectsInPDO = 0x00,
-        .applicationObject_1 = 0x00000000,
-        .applicationObject_2 = 0x00000000,
-        .applicationObject_3 = 0x00000000,
-        .applicationObject_4 = 0x00000000,
-        .applicationObject_5 = 0x00000000,
-        .applicationObject_6 = 0x00000000,
-        .applicationObject_7 = 0x00000000,
-        .applicationObject_8 = 0x00000000
-    }
-};
-
-OD_ATTR_RAM OD_RAM_t OD_RAM = {
-    .x1001_errorRegister = 0x00,
-    .x1010_storeParameters_sub0 = 0x04,
-    .x1010_storeParameters = {0x00000001, 0x00000001, 0x00000001, 0x00000001},
-    .x1011_restoreDefaultParameters_sub0 = 0x04,
-    .x1011_restoreDefaultParameters = {0x00000001, 0x00000001, 0x00000001, 0x00000001},
-    .x1200_SDOServerParameter = {
-        .highestSub_indexSupported = 0x02,
-        .COB_IDClientToServerRx = 0x00000600,
-        .COB_IDServerToClientTx = 0x00000580
+    .x1285_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1F50_newFirmware = {
-        .highestSub_indexSupported = 0x01
+    .x1286_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1F51_programControl = {
-        .highestSub_indexSupported = 0x01,
-        .command = 0x00000000
+    .x1287_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1F56_appSoftIdentification = {
-        .highestSub_indexSupported = 0x01,
-        .crc = 0x00000000
+    .x1288_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x1F57_flashStatusIdentification = {
-        .highestSub_indexSupported = 0x01,
-        .error = 0x00000000
+    .x1289_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x6000_power = {
+    .x128A_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
         .highestSub_indexSupported = 0x03,
-        .energy = 0,
-        .power = 0,
-        .cnt = 0x00000000
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x6200_sys_pwr_sensors = {
-        .highestSub_indexSupported = 0x04,
-        .u_in = 0,
-        .u_out = 0,
-        .i_load = 0,
-        .ir = 0
+    .x128B_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .x6201_th_sensors = {
+    .x128C_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
         .highestSub_indexSupported = 0x03,
-        .temp_cpu = 0,
-        .temp_aht = 0,
-        .hum_aht = 0
-    }
-};
-
-
-
-/*******************************************************************************
-    All OD objects (constant definitions)
-*******************************************************************************/
-typedef struct {
-    OD_obj_var_t o_1000_deviceType;
-    OD_obj_var_t o_1001_errorRegister;
-    OD_obj_array_t o_1003_pre_definedErrorField;
-    OD_obj_var_t o_1005_COB_ID_SYNCMessage;
-    OD_obj_var_t o_1006_communicationCyclePeriod;
-    OD_obj_var_t o_1007_synchronousWindowLength;
-    OD_obj_var_t o_1008_manufacturerDeviceName;
-    OD_obj_var_t o_1009_manufacturerHardwareVersion;
-    OD_obj_var_t o_100A_manufacturerSoftwareVersion;
-    OD_obj_array_t o_1010_storeParameters;
-    OD_obj_array_t o_1011_restoreDefaultParameters;
-    OD_obj_var_t o_1012_COB_IDTimeStampObject;
-    OD_obj_var_t o_1014_COB_ID_EMCY;
-    OD_obj_var_t o_1015_inhibitTimeEMCY;
-    OD_obj_array_t o_1016_consumerHeartbeatTime;
-    OD_obj_var_t o_1017_producerHeartbeatTime;
-    OD_obj_record_t o_1018_identity[8];
-    OD_obj_var_t o_1019_synchronousCounterOverflowValue;
-    OD_obj_record_t o_1200_SDOServerParameter[3];
-    OD_obj_record_t o_1280_SDOClientParameter[4];
-    OD_obj_record_t o_1400_RPDOCommunicationParameter[4];
-    OD_obj_record_t o_1600_RPDOMappingParameter[9];
-    OD_obj_record_t o_1800_TPDOCommunicationParameter[6];
-    OD_obj_record_t o_1A00_TPDOMappingParameter[9];
-    OD_obj_record_t o_1F50_newFirmware[2];
-    OD_obj_record_t o_1F51_programControl[2];
-    OD_obj_record_t o_1F56_appSoftIdentification[2];
-    OD_obj_record_t o_1F57_flashStatusIdentification[2];
-    OD_obj_record_t o_6000_power[4];
-    OD_obj_record_t o_6200_sys_pwr_sensors[5];
-    OD_obj_record_t o_6201_th_sensors[4];
-} ODObjs_t;
-
-static CO_PROGMEM ODObjs_t ODObjs = {
-    .o_1000_deviceType = {
-        .dataOrig = &OD_PERSIST_COMM.x1000_deviceType,
-        .attribute = ODA_SDO_R | ODA_MB,
-        .dataLength = 4
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1001_errorRegister = {
-        .dataOrig = &OD_RAM.x1001_errorRegister,
-        .attribute = ODA_SDO_R | ODA_TPDO,
-        .dataLength = 1
+    .x128D_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1003_pre_definedErrorField = {
-        .dataOrig0 = NULL,
-        .dataOrig = NULL,
-        .attribute0 = ODA_SDO_RW,
-        .attribute = ODA_SDO_R | ODA_MB,
-        .dataElementLength = 4,
-        .dataElementSizeof = sizeof(uint32_t)
+    .x128E_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1005_COB_ID_SYNCMessage = {
-        .dataOrig = &OD_PERSIST_COMM.x1005_COB_ID_SYNCMessage,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 4
+    .x128F_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1006_communicationCyclePeriod = {
-        .dataOrig = &OD_PERSIST_COMM.x1006_communicationCyclePeriod,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 4
+    .x1290_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1007_synchronousWindowLength = {
-        .dataOrig = &OD_PERSIST_COMM.x1007_synchronousWindowLength,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 4
+    .x1291_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1008_manufacturerDeviceName = {
-        .dataOrig = &OD_PERSIST_COMM.x1008_manufacturerDeviceName[0],
-        .attribute = ODA_SDO_R | ODA_STR,
-        .dataLength = 32
+    .x1292_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1009_manufacturerHardwareVersion = {
-        .dataOrig = &OD_PERSIST_COMM.x1009_manufacturerHardwareVersion[0],
-        .attribute = ODA_SDO_R | ODA_STR,
-        .dataLength = 32
+    .x1293_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_100A_manufacturerSoftwareVersion = {
-        .dataOrig = &OD_PERSIST_COMM.x100A_manufacturerSoftwareVersion[0],
-        .attribute = ODA_SDO_R | ODA_STR,
-        .dataLength = 32
+    .x1294_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1010_storeParameters = {
-        .dataOrig0 = &OD_RAM.x1010_storeParameters_sub0,
-        .dataOrig = &OD_RAM.x1010_storeParameters[0],
-        .attribute0 = ODA_SDO_R,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataElementLength = 4,
-        .dataElementSizeof = sizeof(uint32_t)
+    .x1295_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1011_restoreDefaultParameters = {
-        .dataOrig0 = &OD_RAM.x1011_restoreDefaultParameters_sub0,
-        .dataOrig = &OD_RAM.x1011_restoreDefaultParameters[0],
-        .attribute0 = ODA_SDO_R,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataElementLength = 4,
-        .dataElementSizeof = sizeof(uint32_t)
+    .x1296_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
     },
-    .o_1012_COB_IDTimeStampObject = {
-        .dataOrig = &OD_PERSIST_COMM.x1012_COB_IDTimeStampObject,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 4
+    .x1297_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x1298_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x1299_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129A_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129B_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129C_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129D_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129E_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x129F_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12A9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AD_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12AF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12B9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BD_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12BF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12C9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CD_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12CF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12D9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DD_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12DF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12E9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12EA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12EB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12EC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12ED_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12EE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12EF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F0_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F1_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F2_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F3_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F4_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F5_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F6_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F7_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F8_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12F9_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FA_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FB_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FC_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FD_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FE_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x12FF_SDOClientParameter = {
+        .COB_IDClientToServerTx = 0x80000000,
+        .COB_IDServerToClientRx = 0x80000000,
+        .highestSub_indexSupported = 0x03,
+        .node_IDOfTheSDOServer = 0x01
+    },
+    .x1400_RPDOCommunicationParameter = {
+        .COB_IDUsedByRPDO = 0x80000200,
+        .eventTimer = 0x0000,
+        .highestSub_indexSupported = 0x05,
+        .transmissionType = 0xFE
+    },
+    .x1600_RPDOMappingParameter = {
+        .applicationObject_1 = 0x00000000,
+        .applicationObject_2 = 0x00000000,
+        .applicationObject_3 = 0x00000000,
+        .applicationObject_4 = 0x00000000,
+        .applicationObject_5 = 0x00000000,
+        .applicationObject_6 = 0x00000000,
+        .applicationObject_7 = 0x00000000,
+        .applicationObject_8 = 0x00000000,
+        .numberOfMappedApplicationObjectsInPDO = 0x00
+    },
+    .x1800_TPDOCommunicationParameter = {
+        .COB_IDUsedByTPDO = 0xC0000180,
+        .inhibitTime = 0x0000,
+        .eventTimer = 0x0000,
+        .highestSub_indexSupported = 0x06,
+        .transmissionType = 0xFE,
+        .SYNCStartValue = 0x00
+    },
+    .x1A00_TPDOMappingParameter = {
+        .applicationObject_1 = 0x00000000,
+        .applicationObject_2 = 0x00000000,
+        .applicationObject_3 = 0x00000000,
+        .applicationObject_4 = 0x00000000,
+        .applicationObject_5 = 0x00000000,
+        .applicationObject_6 = 0x00000000,
+        .applicationObject_7 = 0x00000000,
+        .applicationObject_8 = 0x00000000,
+        .numberOfMappedApplicationObjectsInPDO = 0x00
+    },
+    .x1015_inhibitTimeEMCY = 0x0000,
+    .x1017_producerHeartbeatTime = 0x0320,
+    .x1008_manufacturerDeviceName = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .x1009_manufacturerHardwareVersion = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .x100A_manufacturerSoftwareVersion = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .x1016_consumerHeartbeatTime_sub0 = 0x7F,
+    .x1019_synchronousCounterOverflowValue = 0x00
+};
+
+OD_ATTR_RAM OD_RAM_t OD_RAM = {
+    .x1010_storeParameters = {0x00000001, 0x00000001, 0x00000001, 0x00000001},
+    .x1011_restoreDefaultParameters = {0x00000001, 0x00000001, 0x00000001, 0x00000001},
+    .x1200_SDOServerParameter = {
+        .COB_IDClientToServerRx = 0x00000600,
+        .COB_IDServerToClientTx = 0x00000580,
+        .highestSub_indexSupported = 0x02
+    },
+    .x1F51_programControl = {
+        .command = 0x00000000,
+        .highestSub_indexSupported = 0x01
+    },
+    .x1F56_appSoftIdentification = {
+        .crc = 0x00000000,
+        .highestSub_indexSupported = 0x01
+    },
+    .x1F57_flashStatusIdentification = {
+        .error = 0x00000000,
+        .highestSub_indexSupported = 0x01
+    },
+    .x6000_power = {
+        .energy = 0,
+        .power = 0,
+        .cnt = 0x00000000,
+        .highestSub_indexSupported = 0x03
+    },
+    .x6200_sys_pwr_sensors = {
+        .u_in = 0,
+        .u_out = 0,
+        .i_load = 0,
+        .ir = 0,
+        .highestSub_indexSupported = 0x04
+    },
+    .x6201_th_sensors = {
+        .temp_cpu = 0,
+        .temp_aht = 0,
+        .hum_aht = 0,
+        .highestSub_indexSupported = 0x03
+    },
+    .x1001_errorRegister = 0x00,
+    .x1010_storeParameters_sub0 = 0x04,
+    .x1011_restoreDefaultParameters_sub0 = 0x04,
+    .x1F50_newFirmware = {
+        .highestSub_indexSupported = 0x01
+    }
+};
+
+
+
+/*******************************************************************************
+    All OD objects (constant definitions)
+*******************************************************************************/
+typedef struct {
+    OD_obj_var_t o_1000_deviceType;
+    OD_obj_var_t o_1001_errorRegister;
+    OD_obj_array_t o_1003_pre_definedErrorField;
+    OD_obj_var_t o_1005_COB_ID_SYNCMessage;
+    OD_obj_var_t o_1006_communicationCyclePeriod;
+    OD_obj_var_t o_1007_synchronousWindowLength;
+    OD_obj_var_t o_1008_manufacturerDeviceName;
+    OD_obj_var_t o_1009_manufacturerHardwareVersion;
+    OD_obj_var_t o_100A_manufacturerSoftwareVersion;
+    OD_obj_array_t o_1010_storeParameters;
+    OD_obj_array_t o_1011_restoreDefaultParameters;
+    OD_obj_var_t o_1012_COB_IDTimeStampObject;
+    OD_obj_var_t o_1014_COB_ID_EMCY;
+    OD_obj_var_t o_1015_inhibitTimeEMCY;
+    OD_obj_array_t o_1016_consumerHeartbeatTime;
+    OD_obj_var_t o_1017_producerHeartbeatTime;
+    OD_obj_record_t o_1018_identity[8];
+    OD_obj_var_t o_1019_synchronousCounterOverflowValue;
+    OD_obj_record_t o_1200_SDOServerParameter[3];
+    OD_obj_record_t o_1280_SDOClientParameter[4];
+    OD_obj_record_t o_1281_SDOClientParameter[4];
+    OD_obj_record_t o_1282_SDOClientParameter[4];
+    OD_obj_record_t o_1283_SDOClientParameter[4];
+    OD_obj_record_t o_1284_SDOClientParameter[4];
+    OD_obj_record_t o_1285_SDOClientParameter[4];
+    OD_obj_record_t o_1286_SDOClientParameter[4];
+    OD_obj_record_t o_1287_SDOClientParameter[4];
+    OD_obj_record_t o_1288_SDOClientParameter[4];
+    OD_obj_record_t o_1289_SDOClientParameter[4];
+    OD_obj_record_t o_128A_SDOClientParameter[4];
+    OD_obj_record_t o_128B_SDOClientParameter[4];
+    OD_obj_record_t o_128C_SDOClientParameter[4];
+    OD_obj_record_t o_128D_SDOClientParameter[4];
+    OD_obj_record_t o_128E_SDOClientParameter[4];
+    OD_obj_record_t o_128F_SDOClientParameter[4];
+    OD_obj_record_t o_1290_SDOClientParameter[4];
+    OD_obj_record_t o_1291_SDOClientParameter[4];
+    OD_obj_record_t o_1292_SDOClientParameter[4];
+    OD_obj_record_t o_1293_SDOClientParameter[4];
+    OD_obj_record_t o_1294_SDOClientParameter[4];
+    OD_obj_record_t o_1295_SDOClientParameter[4];
+    OD_obj_record_t o_1296_SDOClientParameter[4];
+    OD_obj_record_t o_1297_SDOClientParameter[4];
+    OD_obj_record_t o_1298_SDOClientParameter[4];
+    OD_obj_record_t o_1299_SDOClientParameter[4];
+    OD_obj_record_t o_129A_SDOClientParameter[4];
+    OD_obj_record_t o_129B_SDOClientParameter[4];
+    OD_obj_record_t o_129C_SDOClientParameter[4];
+    OD_obj_record_t o_129D_SDOClientParameter[4];
+    OD_obj_record_t o_129E_SDOClientParameter[4];
+    OD_obj_record_t o_129F_SDOClientParameter[4];
+    OD_obj_record_t o_12A0_SDOClientParameter[4];
+    OD_obj_record_t o_12A1_SDOClientParameter[4];
+    OD_obj_record_t o_12A2_SDOClientParameter[4];
+    OD_obj_record_t o_12A3_SDOClientParameter[4];
+    OD_obj_record_t o_12A4_SDOClientParameter[4];
+    OD_obj_record_t o_12A5_SDOClientParameter[4];
+    OD_obj_record_t o_12A6_SDOClientParameter[4];
+    OD_obj_record_t o_12A7_SDOClientParameter[4];
+    OD_obj_record_t o_12A8_SDOClientParameter[4];
+    OD_obj_record_t o_12A9_SDOClientParameter[4];
+    OD_obj_record_t o_12AA_SDOClientParameter[4];
+    OD_obj_record_t o_12AB_SDOClientParameter[4];
+    OD_obj_record_t o_12AC_SDOClientParameter[4];
+    OD_obj_record_t o_12AD_SDOClientParameter[4];
+    OD_obj_record_t o_12AE_SDOClientParameter[4];
+    OD_obj_record_t o_12AF_SDOClientParameter[4];
+    OD_obj_record_t o_12B0_SDOClientParameter[4];
+    OD_obj_record_t o_12B1_SDOClientParameter[4];
+    OD_obj_record_t o_12B2_SDOClientParameter[4];
+    OD_obj_record_t o_12B3_SDOClientParameter[4];
+    OD_obj_record_t o_12B4_SDOClientParameter[4];
+    OD_obj_record_t o_12B5_SDOClientParameter[4];
+    OD_obj_record_t o_12B6_SDOClientParameter[4];
+    OD_obj_record_t o_12B7_SDOClientParameter[4];
+    OD_obj_record_t o_12B8_SDOClientParameter[4];
+    OD_obj_record_t o_12B9_SDOClientParameter[4];
+    OD_obj_record_t o_12BA_SDOClientParameter[4];
+    OD_obj_record_t o_12BB_SDOClientParameter[4];
+    OD_obj_record_t o_12BC_SDOClientParameter[4];
+    OD_obj_record_t o_12BD_SDOClientParameter[4];
+    OD_obj_record_t o_12BE_SDOClientParameter[4];
+    OD_obj_record_t o_12BF_SDOClientParameter[4];
+    OD_obj_record_t o_12C0_SDOClientParameter[4];
+    OD_obj_record_t o_12C1_SDOClientParameter[4];
+    OD_obj_record_t o_12C2_SDOClientParameter[4];
+    OD_obj_record_t o_12C3_SDOClientParameter[4];
+    OD_obj_record_t o_12C4_SDOClientParameter[4];
+    OD_obj_record_t o_12C5_SDOClientParameter[4];
+    OD_obj_record_t o_12C6_SDOClientParameter[4];
+    OD_obj_record_t o_12C7_SDOClientParameter[4];
+    OD_obj_record_t o_12C8_SDOClientParameter[4];
+    OD_obj_record_t o_12C9_SDOClientParameter[4];
+    OD_obj_record_t o_12CA_SDOClientParameter[4];
+    OD_obj_record_t o_12CB_SDOClientParameter[4];
+    OD_obj_record_t o_12CC_SDOClientParameter[4];
+    OD_obj_record_t o_12CD_SDOClientParameter[4];
+    OD_obj_record_t o_12CE_SDOClientParameter[4];
+    OD_obj_record_t o_12CF_SDOClientParameter[4];
+    OD_obj_record_t o_12D0_SDOClientParameter[4];
+    OD_obj_record_t o_12D1_SDOClientParameter[4];
+    OD_obj_record_t o_12D2_SDOClientParameter[4];
+    OD_obj_record_t o_12D3_SDOClientParameter[4];
+    OD_obj_record_t o_12D4_SDOClientParameter[4];
+    OD_obj_record_t o_12D5_SDOClientParameter[4];
+    OD_obj_record_t o_12D6_SDOClientParameter[4];
+    OD_obj_record_t o_12D7_SDOClientParameter[4];
+    OD_obj_record_t o_12D8_SDOClientParameter[4];
+    OD_obj_record_t o_12D9_SDOClientParameter[4];
+    OD_obj_record_t o_12DA_SDOClientParameter[4];
+    OD_obj_record_t o_12DB_SDOClientParameter[4];
+    OD_obj_record_t o_12DC_SDOClientParameter[4];
+    OD_obj_record_t o_12DD_SDOClientParameter[4];
+    OD_obj_record_t o_12DE_SDOClientParameter[4];
+    OD_obj_record_t o_12DF_SDOClientParameter[4];
+    OD_obj_record_t o_12E0_SDOClientParameter[4];
+    OD_obj_record_t o_12E1_SDOClientParameter[4];
+    OD_obj_record_t o_12E2_SDOClientParameter[4];
+    OD_obj_record_t o_12E3_SDOClientParameter[4];
+    OD_obj_record_t o_12E4_SDOClientParameter[4];
+    OD_obj_record_t o_12E5_SDOClientParameter[4];
+    OD_obj_record_t o_12E6_SDOClientParameter[4];
+    OD_obj_record_t o_12E7_SDOClientParameter[4];
+    OD_obj_record_t o_12E8_SDOClientParameter[4];
+    OD_obj_record_t o_12E9_SDOClientParameter[4];
+    OD_obj_record_t o_12EA_SDOClientParameter[4];
+    OD_obj_record_t o_12EB_SDOClientParameter[4];
+    OD_obj_record_t o_12EC_SDOClientParameter[4];
+    OD_obj_record_t o_12ED_SDOClientParameter[4];
+    OD_obj_record_t o_12EE_SDOClientParameter[4];
+    OD_obj_record_t o_12EF_SDOClientParameter[4];
+    OD_obj_record_t o_12F0_SDOClientParameter[4];
+    OD_obj_record_t o_12F1_SDOClientParameter[4];
+    OD_obj_record_t o_12F2_SDOClientParameter[4];
+    OD_obj_record_t o_12F3_SDOClientParameter[4];
+    OD_obj_record_t o_12F4_SDOClientParameter[4];
+    OD_obj_record_t o_12F5_SDOClientParameter[4];
+    OD_obj_record_t o_12F6_SDOClientParameter[4];
+    OD_obj_record_t o_12F7_SDOClientParameter[4];
+    OD_obj_record_t o_12F8_SDOClientParameter[4];
+    OD_obj_record_t o_12F9_SDOClientParameter[4];
+    OD_obj_record_t o_12FA_SDOClientParameter[4];
+    OD_obj_record_t o_12FB_SDOClientParameter[4];
+    OD_obj_record_t o_12FC_SDOClientParameter[4];
+    OD_obj_record_t o_12FD_SDOClientParameter[4];
+    OD_obj_record_t o_12FE_SDOClientParameter[4];
+    OD_obj_record_t o_12FF_SDOClientParameter[4];
+    OD_obj_record_t o_1400_RPDOCommunicationParameter[4];
+    OD_obj_record_t o_1600_RPDOMappingParameter[9];
+    OD_obj_record_t o_1800_TPDOCommunicationParameter[6];
+    OD_obj_record_t o_1A00_TPDOMappingParameter[9];
+    OD_obj_record_t o_1F50_newFirmware[2];
+    OD_obj_record_t o_1F51_programControl[2];
+    OD_obj_record_t o_1F56_appSoftIdentification[2];
+    OD_obj_record_t o_1F57_flashStatusIdentification[2];
+    OD_obj_record_t o_6000_power[4];
+    OD_obj_record_t o_6200_sys_pwr_sensors[5];
+    OD_obj_record_t o_6201_th_sensors[4];
+} ODObjs_t;
+
+static CO_PROGMEM ODObjs_t ODObjs = {
+    .o_1000_deviceType = {
+        .dataOrig = &OD_PERSIST_COMM.x1000_deviceType,
+        .attribute = ODA_SDO_R | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1001_errorRegister = {
+        .dataOrig = &OD_RAM.x1001_errorRegister,
+        .attribute = ODA_SDO_R | ODA_TPDO,
+        .dataLength = 1
+    },
+    .o_1003_pre_definedErrorField = {
+        .dataOrig0 = NULL,
+        .dataOrig = NULL,
+        .attribute0 = ODA_SDO_RW,
+        .attribute = ODA_SDO_R | ODA_MB,
+        .dataElementLength = 4,
+        .dataElementSizeof = sizeof(uint32_t)
+    },
+    .o_1005_COB_ID_SYNCMessage = {
+        .dataOrig = &OD_PERSIST_COMM.x1005_COB_ID_SYNCMessage,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1006_communicationCyclePeriod = {
+        .dataOrig = &OD_PERSIST_COMM.x1006_communicationCyclePeriod,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1007_synchronousWindowLength = {
+        .dataOrig = &OD_PERSIST_COMM.x1007_synchronousWindowLength,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1008_manufacturerDeviceName = {
+        .dataOrig = &OD_PERSIST_COMM.x1008_manufacturerDeviceName[0],
+        .attribute = ODA_SDO_R | ODA_STR,
+        .dataLength = 32
+    },
+    .o_1009_manufacturerHardwareVersion = {
+        .dataOrig = &OD_PERSIST_COMM.x1009_manufacturerHardwareVersion[0],
+        .attribute = ODA_SDO_R | ODA_STR,
+        .dataLength = 32
+    },
+    .o_100A_manufacturerSoftwareVersion = {
+        .dataOrig = &OD_PERSIST_COMM.x100A_manufacturerSoftwareVersion[0],
+        .attribute = ODA_SDO_R | ODA_STR,
+        .dataLength = 32
+    },
+    .o_1010_storeParameters = {
+        .dataOrig0 = &OD_RAM.x1010_storeParameters_sub0,
+        .dataOrig = &OD_RAM.x1010_storeParameters[0],
+        .attribute0 = ODA_SDO_R,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataElementLength = 4,
+        .dataElementSizeof = sizeof(uint32_t)
+    },
+    .o_1011_restoreDefaultParameters = {
+        .dataOrig0 = &OD_RAM.x1011_restoreDefaultParameters_sub0,
+        .dataOrig = &OD_RAM.x1011_restoreDefaultParameters[0],
+        .attribute0 = ODA_SDO_R,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataElementLength = 4,
+        .dataElementSizeof = sizeof(uint32_t)
+    },
+    .o_1012_COB_IDTimeStampObject = {
+        .dataOrig = &OD_PERSIST_COMM.x1012_COB_IDTimeStampObject,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1014_COB_ID_EMCY = {
+        .dataOrig = &OD_PERSIST_COMM.x1014_COB_ID_EMCY,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 4
+    },
+    .o_1015_inhibitTimeEMCY = {
+        .dataOrig = &OD_PERSIST_COMM.x1015_inhibitTimeEMCY,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 2
+    },
+    .o_1016_consumerHeartbeatTime = {
+        .dataOrig0 = &OD_PERSIST_COMM.x1016_consumerHeartbeatTime_sub0,
+        .dataOrig = &OD_PERSIST_COMM.x1016_consumerHeartbeatTime[0],
+        .attribute0 = ODA_SDO_R,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataElementLength = 4,
+        .dataElementSizeof = sizeof(uint32_t)
+    },
+    .o_1017_producerHeartbeatTime = {
+        .dataOrig = &OD_PERSIST_COMM.x1017_producerHeartbeatTime,
+        .attribute = ODA_SDO_RW | ODA_MB,
+        .dataLength = 2
+    },
+    .o_1018_identity = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.vendor_ID,
+            .subIndex = 1,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.productCode,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.revisionNumber,
+            .subIndex = 3,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.serialNumber,
+            .subIndex = 4,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID0,
+            .subIndex = 5,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID1,
+            .subIndex = 6,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID2,
+            .subIndex = 7,
+            .attribute = ODA_SDO_R | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_1019_synchronousCounterOverflowValue = {
+        .dataOrig = &OD_PERSIST_COMM.x1019_synchronousCounterOverflowValue,
+        .attribute = ODA_SDO_RW,
+        .dataLength = 1
+    },
+    .o_1200_SDOServerParameter = {
+        {
+            .dataOrig = &OD_RAM.x1200_SDOServerParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_RAM.x1200_SDOServerParameter.COB_IDClientToServerRx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_R | ODA_TPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_RAM.x1200_SDOServerParameter.COB_IDServerToClientTx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_R | ODA_TPDO | ODA_MB,
+            .dataLength = 4
+        }
+    },
+    .o_1280_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1281_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1281_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1281_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1281_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1281_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1282_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1282_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1282_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1282_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1282_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1283_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1283_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1283_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1283_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1283_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1284_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1284_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1284_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1284_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1284_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1285_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1285_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1285_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1285_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1285_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1286_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1286_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1286_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1286_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1286_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1287_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1287_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1287_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1287_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1287_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1288_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1288_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1288_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1288_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1288_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1289_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1289_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1289_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1289_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1289_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128A_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128A_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128A_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128A_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128A_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128B_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128B_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128B_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128B_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128B_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128C_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128C_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128C_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128C_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128C_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128D_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128D_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128D_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128D_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128D_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128E_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128E_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128E_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128E_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128E_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_128F_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128F_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128F_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128F_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x128F_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1290_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1290_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1290_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1290_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1290_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1291_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1291_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1291_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1291_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1291_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1292_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1292_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1292_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1292_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1292_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1293_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1293_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1293_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1293_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1293_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1294_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1294_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1294_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1294_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1294_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1295_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1295_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1295_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1295_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1295_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1296_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1296_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1296_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1296_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1296_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1297_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1297_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1297_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1297_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1297_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1298_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1298_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1298_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1298_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1298_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_1299_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1299_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1299_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1299_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x1299_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129A_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129A_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129A_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129A_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129A_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129B_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129B_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129B_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129B_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129B_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129C_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129C_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129C_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129C_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129C_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129D_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129D_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129D_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129D_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129D_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129E_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129E_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129E_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129E_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129E_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_129F_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129F_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129F_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129F_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x129F_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12A9_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A9_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A9_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A9_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12A9_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AD_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AD_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AD_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AD_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AD_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AE_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AE_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AE_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AE_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12AF_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AF_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AF_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AF_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12AF_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12B9_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B9_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B9_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B9_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12B9_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BD_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BD_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BD_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BD_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BD_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BE_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BE_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BE_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BE_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12BF_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BF_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BF_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BF_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12BF_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12C9_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C9_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C9_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C9_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12C9_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CD_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CD_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CD_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CD_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CD_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CE_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CE_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CE_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CE_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12CF_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CF_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CF_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CF_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12CF_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12D9_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D9_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D9_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D9_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12D9_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DD_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DD_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DD_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DD_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DD_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DE_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DE_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DE_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DE_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12DF_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DF_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DF_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DF_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12DF_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12E9_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E9_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E9_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E9_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12E9_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12EA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12EB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12EC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12ED_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12ED_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12ED_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12ED_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12ED_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12EE_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EE_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EE_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EE_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12EF_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EF_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EF_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EF_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12EF_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12F0_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F0_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F0_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F0_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F0_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12F1_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F1_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F1_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F1_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F1_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12F2_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F2_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F2_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F2_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F2_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12F3_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F3_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F3_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F3_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F3_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12F4_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F4_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F4_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F4_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F4_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1014_COB_ID_EMCY = {
-        .dataOrig = &OD_PERSIST_COMM.x1014_COB_ID_EMCY,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 4
+    .o_12F5_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F5_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F5_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F5_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F5_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1015_inhibitTimeEMCY = {
-        .dataOrig = &OD_PERSIST_COMM.x1015_inhibitTimeEMCY,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 2
+    .o_12F6_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F6_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F6_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F6_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F6_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1016_consumerHeartbeatTime = {
-        .dataOrig0 = &OD_PERSIST_COMM.x1016_consumerHeartbeatTime_sub0,
-        .dataOrig = &OD_PERSIST_COMM.x1016_consumerHeartbeatTime[0],
-        .attribute0 = ODA_SDO_R,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataElementLength = 4,
-        .dataElementSizeof = sizeof(uint32_t)
+    .o_12F7_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F7_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F7_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F7_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F7_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1017_producerHeartbeatTime = {
-        .dataOrig = &OD_PERSIST_COMM.x1017_producerHeartbeatTime,
-        .attribute = ODA_SDO_RW | ODA_MB,
-        .dataLength = 2
+    .o_12F8_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F8_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F8_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F8_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12F8_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1018_identity = {
+    .o_12F9_SDOClientParameter = {
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.highestSub_indexSupported,
+            .dataOrig = &OD_PERSIST_COMM.x12F9_SDOClientParameter.highestSub_indexSupported,
             .subIndex = 0,
             .attribute = ODA_SDO_R,
             .dataLength = 1
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.vendor_ID,
+            .dataOrig = &OD_PERSIST_COMM.x12F9_SDOClientParameter.COB_IDClientToServerTx,
             .subIndex = 1,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.productCode,
+            .dataOrig = &OD_PERSIST_COMM.x12F9_SDOClientParameter.COB_IDServerToClientRx,
             .subIndex = 2,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.revisionNumber,
+            .dataOrig = &OD_PERSIST_COMM.x12F9_SDOClientParameter.node_IDOfTheSDOServer,
             .subIndex = 3,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12FA_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FA_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FA_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.serialNumber,
-            .subIndex = 4,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .dataOrig = &OD_PERSIST_COMM.x12FA_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID0,
-            .subIndex = 5,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .dataOrig = &OD_PERSIST_COMM.x12FA_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12FB_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FB_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FB_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID1,
-            .subIndex = 6,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .dataOrig = &OD_PERSIST_COMM.x12FB_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1018_identity.UID2,
-            .subIndex = 7,
-            .attribute = ODA_SDO_R | ODA_MB,
+            .dataOrig = &OD_PERSIST_COMM.x12FB_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
+    },
+    .o_12FC_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FC_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FC_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FC_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FC_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
         }
     },
-    .o_1019_synchronousCounterOverflowValue = {
-        .dataOrig = &OD_PERSIST_COMM.x1019_synchronousCounterOverflowValue,
-        .attribute = ODA_SDO_RW,
-        .dataLength = 1
+    .o_12FD_SDOClientParameter = {
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FD_SDOClientParameter.highestSub_indexSupported,
+            .subIndex = 0,
+            .attribute = ODA_SDO_R,
+            .dataLength = 1
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FD_SDOClientParameter.COB_IDClientToServerTx,
+            .subIndex = 1,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FD_SDOClientParameter.COB_IDServerToClientRx,
+            .subIndex = 2,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
+            .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FD_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
+        }
     },
-    .o_1200_SDOServerParameter = {
+    .o_12FE_SDOClientParameter = {
         {
-            .dataOrig = &OD_RAM.x1200_SDOServerParameter.highestSub_indexSupported,
+            .dataOrig = &OD_PERSIST_COMM.x12FE_SDOClientParameter.highestSub_indexSupported,
             .subIndex = 0,
             .attribute = ODA_SDO_R,
             .dataLength = 1
         },
         {
-            .dataOrig = &OD_RAM.x1200_SDOServerParameter.COB_IDClientToServerRx,
+            .dataOrig = &OD_PERSIST_COMM.x12FE_SDOClientParameter.COB_IDClientToServerTx,
             .subIndex = 1,
-            .attribute = ODA_SDO_R | ODA_TPDO | ODA_MB,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_RAM.x1200_SDOServerParameter.COB_IDServerToClientTx,
+            .dataOrig = &OD_PERSIST_COMM.x12FE_SDOClientParameter.COB_IDServerToClientRx,
             .subIndex = 2,
-            .attribute = ODA_SDO_R | ODA_TPDO | ODA_MB,
+            .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
+        },
+        {
+            .dataOrig = &OD_PERSIST_COMM.x12FE_SDOClientParameter.node_IDOfTheSDOServer,
+            .subIndex = 3,
+            .attribute = ODA_SDO_RW,
+            .dataLength = 1
         }
     },
-    .o_1280_SDOClientParameter = {
+    .o_12FF_SDOClientParameter = {
         {
-            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.highestSub_indexSupported,
+            .dataOrig = &OD_PERSIST_COMM.x12FF_SDOClientParameter.highestSub_indexSupported,
             .subIndex = 0,
             .attribute = ODA_SDO_R,
             .dataLength = 1
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDClientToServerTx,
+            .dataOrig = &OD_PERSIST_COMM.x12FF_SDOClientParameter.COB_IDClientToServerTx,
             .subIndex = 1,
             .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.COB_IDServerToClientRx,
+            .dataOrig = &OD_PERSIST_COMM.x12FF_SDOClientParameter.COB_IDServerToClientRx,
             .subIndex = 2,
             .attribute = ODA_SDO_RW | ODA_TRPDO | ODA_MB,
             .dataLength = 4
         },
         {
-            .dataOrig = &OD_PERSIST_COMM.x1280_SDOClientParameter.node_IDOfTheSDOServer,
+            .dataOrig = &OD_PERSIST_COMM.x12FF_SDOClientParameter.node_IDOfTheSDOServer,
             .subIndex = 3,
             .attribute = ODA_SDO_RW,
             .dataLength = 1
@@ -712,6 +4904,133 @@ static OD_ATTR_OD OD_entry_t ODList[] = {
     {0x1019, 0x01, ODT_VAR, &ODObjs.o_1019_synchronousCounterOverflowValue, NULL},
     {0x1200, 0x03, ODT_REC, &ODObjs.o_1200_SDOServerParameter, NULL},
     {0x1280, 0x04, ODT_REC, &ODObjs.o_1280_SDOClientParameter, NULL},
+    {0x1281, 0x04, ODT_REC, &ODObjs.o_1281_SDOClientParameter, NULL},
+    {0x1282, 0x04, ODT_REC, &ODObjs.o_1282_SDOClientParameter, NULL},
+    {0x1283, 0x04, ODT_REC, &ODObjs.o_1283_SDOClientParameter, NULL},
+    {0x1284, 0x04, ODT_REC, &ODObjs.o_1284_SDOClientParameter, NULL},
+    {0x1285, 0x04, ODT_REC, &ODObjs.o_1285_SDOClientParameter, NULL},
+    {0x1286, 0x04, ODT_REC, &ODObjs.o_1286_SDOClientParameter, NULL},
+    {0x1287, 0x04, ODT_REC, &ODObjs.o_1287_SDOClientParameter, NULL},
+    {0x1288, 0x04, ODT_REC, &ODObjs.o_1288_SDOClientParameter, NULL},
+    {0x1289, 0x04, ODT_REC, &ODObjs.o_1289_SDOClientParameter, NULL},
+    {0x128A, 0x04, ODT_REC, &ODObjs.o_128A_SDOClientParameter, NULL},
+    {0x128B, 0x04, ODT_REC, &ODObjs.o_128B_SDOClientParameter, NULL},
+    {0x128C, 0x04, ODT_REC, &ODObjs.o_128C_SDOClientParameter, NULL},
+    {0x128D, 0x04, ODT_REC, &ODObjs.o_128D_SDOClientParameter, NULL},
+    {0x128E, 0x04, ODT_REC, &ODObjs.o_128E_SDOClientParameter, NULL},
+    {0x128F, 0x04, ODT_REC, &ODObjs.o_128F_SDOClientParameter, NULL},
+    {0x1290, 0x04, ODT_REC, &ODObjs.o_1290_SDOClientParameter, NULL},
+    {0x1291, 0x04, ODT_REC, &ODObjs.o_1291_SDOClientParameter, NULL},
+    {0x1292, 0x04, ODT_REC, &ODObjs.o_1292_SDOClientParameter, NULL},
+    {0x1293, 0x04, ODT_REC, &ODObjs.o_1293_SDOClientParameter, NULL},
+    {0x1294, 0x04, ODT_REC, &ODObjs.o_1294_SDOClientParameter, NULL},
+    {0x1295, 0x04, ODT_REC, &ODObjs.o_1295_SDOClientParameter, NULL},
+    {0x1296, 0x04, ODT_REC, &ODObjs.o_1296_SDOClientParameter, NULL},
+    {0x1297, 0x04, ODT_REC, &ODObjs.o_1297_SDOClientParameter, NULL},
+    {0x1298, 0x04, ODT_REC, &ODObjs.o_1298_SDOClientParameter, NULL},
+    {0x1299, 0x04, ODT_REC, &ODObjs.o_1299_SDOClientParameter, NULL},
+    {0x129A, 0x04, ODT_REC, &ODObjs.o_129A_SDOClientParameter, NULL},
+    {0x129B, 0x04, ODT_REC, &ODObjs.o_129B_SDOClientParameter, NULL},
+    {0x129C, 0x04, ODT_REC, &ODObjs.o_129C_SDOClientParameter, NULL},
+    {0x129D, 0x04, ODT_REC, &ODObjs.o_129D_SDOClientParameter, NULL},
+    {0x129E, 0x04, ODT_REC, &ODObjs.o_129E_SDOClientParameter, NULL},
+    {0x129F, 0x04, ODT_REC, &ODObjs.o_129F_SDOClientParameter, NULL},
+    {0x12A0, 0x04, ODT_REC, &ODObjs.o_12A0_SDOClientParameter, NULL},
+    {0x12A1, 0x04, ODT_REC, &ODObjs.o_12A1_SDOClientParameter, NULL},
+    {0x12A2, 0x04, ODT_REC, &ODObjs.o_12A2_SDOClientParameter, NULL},
+    {0x12A3, 0x04, ODT_REC, &ODObjs.o_12A3_SDOClientParameter, NULL},
+    {0x12A4, 0x04, ODT_REC, &ODObjs.o_12A4_SDOClientParameter, NULL},
+    {0x12A5, 0x04, ODT_REC, &ODObjs.o_12A5_SDOClientParameter, NULL},
+    {0x12A6, 0x04, ODT_REC, &ODObjs.o_12A6_SDOClientParameter, NULL},
+    {0x12A7, 0x04, ODT_REC, &ODObjs.o_12A7_SDOClientParameter, NULL},
+    {0x12A8, 0x04, ODT_REC, &ODObjs.o_12A8_SDOClientParameter, NULL},
+    {0x12A9, 0x04, ODT_REC, &ODObjs.o_12A9_SDOClientParameter, NULL},
+    {0x12AA, 0x04, ODT_REC, &ODObjs.o_12AA_SDOClientParameter, NULL},
+    {0x12AB, 0x04, ODT_REC, &ODObjs.o_12AB_SDOClientParameter, NULL},
+    {0x12AC, 0x04, ODT_REC, &ODObjs.o_12AC_SDOClientParameter, NULL},
+    {0x12AD, 0x04, ODT_REC, &ODObjs.o_12AD_SDOClientParameter, NULL},
+    {0x12AE, 0x04, ODT_REC, &ODObjs.o_12AE_SDOClientParameter, NULL},
+    {0x12AF, 0x04, ODT_REC, &ODObjs.o_12AF_SDOClientParameter, NULL},
+    {0x12B0, 0x04, ODT_REC, &ODObjs.o_12B0_SDOClientParameter, NULL},
+    {0x12B1, 0x04, ODT_REC, &ODObjs.o_12B1_SDOClientParameter, NULL},
+    {0x12B2, 0x04, ODT_REC, &ODObjs.o_12B2_SDOClientParameter, NULL},
+    {0x12B3, 0x04, ODT_REC, &ODObjs.o_12B3_SDOClientParameter, NULL},
+    {0x12B4, 0x04, ODT_REC, &ODObjs.o_12B4_SDOClientParameter, NULL},
+    {0x12B5, 0x04, ODT_REC, &ODObjs.o_12B5_SDOClientParameter, NULL},
+    {0x12B6, 0x04, ODT_REC, &ODObjs.o_12B6_SDOClientParameter, NULL},
+    {0x12B7, 0x04, ODT_REC, &ODObjs.o_12B7_SDOClientParameter, NULL},
+    {0x12B8, 0x04, ODT_REC, &ODObjs.o_12B8_SDOClientParameter, NULL},
+    {0x12B9, 0x04, ODT_REC, &ODObjs.o_12B9_SDOClientParameter, NULL},
+    {0x12BA, 0x04, ODT_REC, &ODObjs.o_12BA_SDOClientParameter, NULL},
+    {0x12BB, 0x04, ODT_REC, &ODObjs.o_12BB_SDOClientParameter, NULL},
+    {0x12BC, 0x04, ODT_REC, &ODObjs.o_12BC_SDOClientParameter, NULL},
+    {0x12BD, 0x04, ODT_REC, &ODObjs.o_12BD_SDOClientParameter, NULL},
+    {0x12BE, 0x04, ODT_REC, &ODObjs.o_12BE_SDOClientParameter, NULL},
+    {0x12BF, 0x04, ODT_REC, &ODObjs.o_12BF_SDOClientParameter, NULL},
+    {0x12C0, 0x04, ODT_REC, &ODObjs.o_12C0_SDOClientParameter, NULL},
+    {0x12C1, 0x04, ODT_REC, &ODObjs.o_12C1_SDOClientParameter, NULL},
+    {0x12C2, 0x04, ODT_REC, &ODObjs.o_12C2_SDOClientParameter, NULL},
+    {0x12C3, 0x04, ODT_REC, &ODObjs.o_12C3_SDOClientParameter, NULL},
+    {0x12C4, 0x04, ODT_REC, &ODObjs.o_12C4_SDOClientParameter, NULL},
+    {0x12C5, 0x04, ODT_REC, &ODObjs.o_12C5_SDOClientParameter, NULL},
+    {0x12C6, 0x04, ODT_REC, &ODObjs.o_12C6_SDOClientParameter, NULL},
+    {0x12C7, 0x04, ODT_REC, &ODObjs.o_12C7_SDOClientParameter, NULL},
+    {0x12C8, 0x04, ODT_REC, &ODObjs.o_12C8_SDOClientParameter, NULL},
+    {0x12C9, 0x04, ODT_REC, &ODObjs.o_12C9_SDOClientParameter, NULL},
+    {0x12CA, 0x04, ODT_REC, &ODObjs.o_12CA_SDOClientParameter, NULL},
+    {0x12CB, 0x04, ODT_REC, &ODObjs.o_12CB_SDOClientParameter, NULL},
+    {0x12CC, 0x04, ODT_REC, &ODObjs.o_12CC_SDOClientParameter, NULL},
+    {0x12CD, 0x04, ODT_REC, &ODObjs.o_12CD_SDOClientParameter, NULL},
+    {0x12CE, 0x04, ODT_REC, &ODObjs.o_12CE_SDOClientParameter, NULL},
+    {0x12CF, 0x04, ODT_REC, &ODObjs.o_12CF_SDOClientParameter, NULL},
+    {0x12D0, 0x04, ODT_REC, &ODObjs.o_12D0_SDOClientParameter, NULL},
+    {0x12D1, 0x04, ODT_REC, &ODObjs.o_12D1_SDOClientParameter, NULL},
+    {0x12D2, 0x04, ODT_REC, &ODObjs.o_12D2_SDOClientParameter, NULL},
+    {0x12D3, 0x04, ODT_REC, &ODObjs.o_12D3_SDOClientParameter, NULL},
+    {0x12D4, 0x04, ODT_REC, &ODObjs.o_12D4_SDOClientParameter, NULL},
+    {0x12D5, 0x04, ODT_REC, &ODObjs.o_12D5_SDOClientParameter, NULL},
+    {0x12D6, 0x04, ODT_REC, &ODObjs.o_12D6_SDOClientParameter, NULL},
+    {0x12D7, 0x04, ODT_REC, &ODObjs.o_12D7_SDOClientParameter, NULL},
+    {0x12D8, 0x04, ODT_REC, &ODObjs.o_12D8_SDOClientParameter, NULL},
+    {0x12D9, 0x04, ODT_REC, &ODObjs.o_12D9_SDOClientParameter, NULL},
+    {0x12DA, 0x04, ODT_REC, &ODObjs.o_12DA_SDOClientParameter, NULL},
+    {0x12DB, 0x04, ODT_REC, &ODObjs.o_12DB_SDOClientParameter, NULL},
+    {0x12DC, 0x04, ODT_REC, &ODObjs.o_12DC_SDOClientParameter, NULL},
+    {0x12DD, 0x04, ODT_REC, &ODObjs.o_12DD_SDOClientParameter, NULL},
+    {0x12DE, 0x04, ODT_REC, &ODObjs.o_12DE_SDOClientParameter, NULL},
+    {0x12DF, 0x04, ODT_REC, &ODObjs.o_12DF_SDOClientParameter, NULL},
+    {0x12E0, 0x04, ODT_REC, &ODObjs.o_12E0_SDOClientParameter, NULL},
+    {0x12E1, 0x04, ODT_REC, &ODObjs.o_12E1_SDOClientParameter, NULL},
+    {0x12E2, 0x04, ODT_REC, &ODObjs.o_12E2_SDOClientParameter, NULL},
+    {0x12E3, 0x04, ODT_REC, &ODObjs.o_12E3_SDOClientParameter, NULL},
+    {0x12E4, 0x04, ODT_REC, &ODObjs.o_12E4_SDOClientParameter, NULL},
+    {0x12E5, 0x04, ODT_REC, &ODObjs.o_12E5_SDOClientParameter, NULL},
+    {0x12E6, 0x04, ODT_REC, &ODObjs.o_12E6_SDOClientParameter, NULL},
+    {0x12E7, 0x04, ODT_REC, &ODObjs.o_12E7_SDOClientParameter, NULL},
+    {0x12E8, 0x04, ODT_REC, &ODObjs.o_12E8_SDOClientParameter, NULL},
+    {0x12E9, 0x04, ODT_REC, &ODObjs.o_12E9_SDOClientParameter, NULL},
+    {0x12EA, 0x04, ODT_REC, &ODObjs.o_12EA_SDOClientParameter, NULL},
+    {0x12EB, 0x04, ODT_REC, &ODObjs.o_12EB_SDOClientParameter, NULL},
+    {0x12EC, 0x04, ODT_REC, &ODObjs.o_12EC_SDOClientParameter, NULL},
+    {0x12ED, 0x04, ODT_REC, &ODObjs.o_12ED_SDOClientParameter, NULL},
+    {0x12EE, 0x04, ODT_REC, &ODObjs.o_12EE_SDOClientParameter, NULL},
+    {0x12EF, 0x04, ODT_REC, &ODObjs.o_12EF_SDOClientParameter, NULL},
+    {0x12F0, 0x04, ODT_REC, &ODObjs.o_12F0_SDOClientParameter, NULL},
+    {0x12F1, 0x04, ODT_REC, &ODObjs.o_12F1_SDOClientParameter, NULL},
+    {0x12F2, 0x04, ODT_REC, &ODObjs.o_12F2_SDOClientParameter, NULL},
+    {0x12F3, 0x04, ODT_REC, &ODObjs.o_12F3_SDOClientParameter, NULL},
+    {0x12F4, 0x04, ODT_REC, &ODObjs.o_12F4_SDOClientParameter, NULL},
+    {0x12F5, 0x04, ODT_REC, &ODObjs.o_12F5_SDOClientParameter, NULL},
+    {0x12F6, 0x04, ODT_REC, &ODObjs.o_12F6_SDOClientParameter, NULL},
+    {0x12F7, 0x04, ODT_REC, &ODObjs.o_12F7_SDOClientParameter, NULL},
+    {0x12F8, 0x04, ODT_REC, &ODObjs.o_12F8_SDOClientParameter, NULL},
+    {0x12F9, 0x04, ODT_REC, &ODObjs.o_12F9_SDOClientParameter, NULL},
+    {0x12FA, 0x04, ODT_REC, &ODObjs.o_12FA_SDOClientParameter, NULL},
+    {0x12FB, 0x04, ODT_REC, &ODObjs.o_12FB_SDOClientParameter, NULL},
+    {0x12FC, 0x04, ODT_REC, &ODObjs.o_12FC_SDOClientParameter, NULL},
+    {0x12FD, 0x04, ODT_REC, &ODObjs.o_12FD_SDOClientParameter, NULL},
+    {0x12FE, 0x04, ODT_REC, &ODObjs.o_12FE_SDOClientParameter, NULL},
+    {0x12FF, 0x04, ODT_REC, &ODObjs.o_12FF_SDOClientParameter, NULL},
     {0x1400, 0x04, ODT_REC, &ODObjs.o_1400_RPDOCommunicationParameter, NULL},
     {0x1600, 0x09, ODT_REC, &ODObjs.o_1600_RPDOMappingParameter, NULL},
     {0x1800, 0x06, ODT_REC, &ODObjs.o_1800_TPDOCommunicationParameter, NULL},
@@ -726,9 +5045,200 @@ static OD_ATTR_OD OD_entry_t ODList[] = {
     {0x0000, 0x00, 0, NULL, NULL}
 };
 
+
+/*******************************************************************************
+    Direct index for OD_find(): ODList position by index, 0xFFFF (OD_LUT_NONE)
+    if absent, one table per high byte of the index in use
+*******************************************************************************/
+static CO_PROGMEM uint16_t ODLut10[256] = {
+    0x0000, 0x0001, 0xFFFF, 0x0002, 0xFFFF, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0009, 0x000A, 0x000B, 0xFFFF, 0x000C, 0x000D, 0x000E, 0x000F, 0x0010, 0x0011, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut12[256] = {
+    0x0012, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022,
+    0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F, 0x0030, 0x0031, 0x0032,
+    0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F, 0x0040, 0x0041, 0x0042,
+    0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052,
+    0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061, 0x0062,
+    0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072,
+    0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F, 0x0080, 0x0081, 0x0082,
+    0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092
+};
+
+static CO_PROGMEM uint16_t ODLut14[256] = {
+    0x0093, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut16[256] = {
+    0x0094, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut18[256] = {
+    0x0095, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut1A[256] = {
+    0x0096, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut1F[256] = {
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0097, 0x0098, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0099, 0x009A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut60[256] = {
+    0x009B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM uint16_t ODLut62[256] = {
+    0x009C, 0x009D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF
+};
+
+static CO_PROGMEM OD_lut_t ODLut = {
+    .page = {
+        [0x10] = ODLut10,
+        [0x12] = ODLut12,
+        [0x14] = ODLut14,
+        [0x16] = ODLut16,
+        [0x18] = ODLut18,
+        [0x1A] = ODLut1A,
+        [0x1F] = ODLut1F,
+        [0x60] = ODLut60,
+        [0x62] = ODLut62,
+    }
+};
+
 static OD_t _OD = {
     (sizeof(ODList) / sizeof(ODList[0])) - 1,
-    &ODList[0]
+    &ODList[0],
+    &ODLut
 };
 
 OD_t *OD = &_OD;
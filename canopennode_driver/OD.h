@@ -1,7 +1,8 @@
 /*******************************************************************************
     CANopen Object Dictionary definition for CANopenNode V4
 
-    This file was automatically generated by CANopenEditor v4.0-51-g2d9b1ad
+    This file was automatically generated by od_gen (make od) from the
+    CANopenEditor project
 
     https://github.com/CANopenNode/CANopenNode
     https://github.com/CANopenNode/CANopenEditor
@@ -22,7 +23,7 @@
     Device Info:
         Vendor Name:  Home
         Vendor ID:    
-        Product Name: GW
+        Product Name: Bridge
         Product ID:   
 
         Description:  
@@ -43,7 +44,7 @@
 #define OD_CNT_HB_CONS 1
 #define OD_CNT_HB_PROD 1
 #define OD_CNT_SDO_SRV 1
-#define OD_CNT_SDO_CLI 1
+#define OD_CNT_SDO_CLI 128
 #define OD_CNT_RPDO 1
 #define OD_CNT_TPDO 1
 
@@ -65,40 +66,794 @@ typedef struct {
     uint32_t x1005_COB_ID_SYNCMessage;
     uint32_t x1006_communicationCyclePeriod;
     uint32_t x1007_synchronousWindowLength;
-    char x1008_manufacturerDeviceName[33];
-    char x1009_manufacturerHardwareVersion[33];
-    char x100A_manufacturerSoftwareVersion[33];
     uint32_t x1012_COB_IDTimeStampObject;
     uint32_t x1014_COB_ID_EMCY;
-    uint16_t x1015_inhibitTimeEMCY;
-    uint8_t x1016_consumerHeartbeatTime_sub0;
     uint32_t x1016_consumerHeartbeatTime[OD_CNT_ARR_1016];
-    uint16_t x1017_producerHeartbeatTime;
     struct {
+        uint32_t vendor_ID;
+        uint32_t productCode;
+        uint32_t revisionNumber;
+        uint32_t serialNumber;
+        uint32_t UID0;
+        uint32_t UID1;
+        uint32_t UID2;
+        uint8_t highestSub_indexSupported;
+    } x1018_identity;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1280_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1281_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1282_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1283_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1284_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1285_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1286_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1287_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1288_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1289_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128A_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128B_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128C_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128D_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128E_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x128F_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1290_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1291_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1292_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1293_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1294_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1295_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1296_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1297_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1298_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x1299_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129A_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129B_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129C_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129D_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129E_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x129F_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A7_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A8_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12A9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AD_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AE_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12AF_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B7_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B8_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12B9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BD_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BE_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12BF_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C7_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C8_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12C9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CD_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CE_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12CF_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
         uint8_t highestSub_indexSupported;
-        uint32_t vendor_ID;
-        uint32_t productCode;
-        uint32_t revisionNumber;
-        uint32_t serialNumber;
-        uint32_t UID0;
-        uint32_t UID1;
-        uint32_t UID2;
-    } x1018_identity;
-    uint8_t x1019_synchronousCounterOverflowValue;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D7_SDOClientParameter;
     struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
         uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12D8_SDOClientParameter;
+    struct {
         uint32_t COB_IDClientToServerTx;
         uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
         uint8_t node_IDOfTheSDOServer;
-    } x1280_SDOClientParameter;
+    } x12D9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DD_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DE_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12DF_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E7_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E8_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12E9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12EA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12EB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12EC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12ED_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12EE_SDOClientParameter;
     struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12EF_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F0_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F1_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F2_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F3_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F4_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F5_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F6_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F7_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F8_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12F9_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FA_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FB_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FC_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FD_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
+        uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FE_SDOClientParameter;
+    struct {
+        uint32_t COB_IDClientToServerTx;
+        uint32_t COB_IDServerToClientRx;
         uint8_t highestSub_indexSupported;
+        uint8_t node_IDOfTheSDOServer;
+    } x12FF_SDOClientParameter;
+    struct {
         uint32_t COB_IDUsedByRPDO;
-        uint8_t transmissionType;
         uint16_t eventTimer;
+        uint8_t highestSub_indexSupported;
+        uint8_t transmissionType;
     } x1400_RPDOCommunicationParameter;
     struct {
-        uint8_t numberOfMappedApplicationObjectsInPDO;
         uint32_t applicationObject_1;
         uint32_t applicationObject_2;
         uint32_t applicationObject_3;
@@ -107,17 +862,17 @@ typedef struct {
         uint32_t applicationObject_6;
         uint32_t applicationObject_7;
         uint32_t applicationObject_8;
+        uint8_t numberOfMappedApplicationObjectsInPDO;
     } x1600_RPDOMappingParameter;
     struct {
-        uint8_t highestSub_indexSupported;
         uint32_t COB_IDUsedByTPDO;
-        uint8_t transmissionType;
         uint16_t inhibitTime;
         uint16_t eventTimer;
+        uint8_t highestSub_indexSupported;
+        uint8_t transmissionType;
         uint8_t SYNCStartValue;
     } x1800_TPDOCommunicationParameter;
     struct {
-        uint8_t numberOfMappedApplicationObjectsInPDO;
         uint32_t applicationObject_1;
         uint32_t applicationObject_2;
         uint32_t applicationObject_3;
@@ -126,54 +881,62 @@ typedef struct {
         uint32_t applicationObject_6;
         uint32_t applicationObject_7;
         uint32_t applicationObject_8;
+        uint8_t numberOfMappedApplicationObjectsInPDO;
     } x1A00_TPDOMappingParameter;
+    uint16_t x1015_inhibitTimeEMCY;
+    uint16_t x1017_producerHeartbeatTime;
+    char x1008_manufacturerDeviceName[33];
+    char x1009_manufacturerHardwareVersion[33];
+    char x100A_manufacturerSoftwareVersion[33];
+    uint8_t x1016_consumerHeartbeatTime_sub0;
+    uint8_t x1019_synchronousCounterOverflowValue;
 } OD_PERSIST_COMM_t;
 
 typedef struct {
-    uint8_t x1001_errorRegister;
-    uint8_t x1010_storeParameters_sub0;
     uint32_t x1010_storeParameters[OD_CNT_ARR_1010];
-    uint8_t x1011_restoreDefaultParameters_sub0;
     uint32_t x1011_restoreDefaultParameters[OD_CNT_ARR_1011];
     struct {
-        uint8_t highestSub_indexSupported;
         uint32_t COB_IDClientToServerRx;
         uint32_t COB_IDServerToClientTx;
-    } x1200_SDOServerParameter;
-    struct {
         uint8_t highestSub_indexSupported;
-    } x1F50_newFirmware;
+    } x1200_SDOServerParameter;
     struct {
-        uint8_t highestSub_indexSupported;
         uint32_t command;
+        uint8_t highestSub_indexSupported;
     } x1F51_programControl;
     struct {
-        uint8_t highestSub_indexSupported;
         uint32_t crc;
+        uint8_t highestSub_indexSupported;
     } x1F56_appSoftIdentification;
     struct {
-        uint8_t highestSub_indexSupported;
         uint32_t error;
+        uint8_t highestSub_indexSupported;
     } x1F57_flashStatusIdentification;
     struct {
-        uint8_t highestSub_indexSupported;
         float32_t energy;
         float32_t power;
         uint32_t cnt;
+        uint8_t highestSub_indexSupported;
     } x6000_power;
     struct {
-        uint8_t highestSub_indexSupported;
         float32_t u_in;
         float32_t u_out;
         float32_t i_load;
         float32_t ir;
+        uint8_t highestSub_indexSupported;
     } x6200_sys_pwr_sensors;
     struct {
-        uint8_t highestSub_indexSupported;
         float32_t temp_cpu;
         float32_t temp_aht;
         float32_t hum_aht;
+        uint8_t highestSub_indexSupported;
     } x6201_th_sensors;
+    uint8_t x1001_errorRegister;
+    uint8_t x1010_storeParameters_sub0;
+    uint8_t x1011_restoreDefaultParameters_sub0;
+    struct {
+        uint8_t highestSub_indexSupported;
+    } x1F50_newFirmware;
 } OD_RAM_t;
 
 #ifndef OD_ATTR_PERSIST_COMM
@@ -215,17 +978,144 @@ extern OD_ATTR_OD OD_t *OD;
 #define OD_ENTRY_H1019 &OD->list[17]
 #define OD_ENTRY_H1200 &OD->list[18]
 #define OD_ENTRY_H1280 &OD->list[19]
-#define OD_ENTRY_H1400 &OD->list[20]
-#define OD_ENTRY_H1600 &OD->list[21]
-#define OD_ENTRY_H1800 &OD->list[22]
-#define OD_ENTRY_H1A00 &OD->list[23]
-#define OD_ENTRY_H1F50 &OD->list[24]
-#define OD_ENTRY_H1F51 &OD->list[25]
-#define OD_ENTRY_H1F56 &OD->list[26]
-#define OD_ENTRY_H1F57 &OD->list[27]
-#define OD_ENTRY_H6000 &OD->list[28]
-#define OD_ENTRY_H6200 &OD->list[29]
-#define OD_ENTRY_H6201 &OD->list[30]
+#define OD_ENTRY_H1281 &OD->list[20]
+#define OD_ENTRY_H1282 &OD->list[21]
+#define OD_ENTRY_H1283 &OD->list[22]
+#define OD_ENTRY_H1284 &OD->list[23]
+#define OD_ENTRY_H1285 &OD->list[24]
+#define OD_ENTRY_H1286 &OD->list[25]
+#define OD_ENTRY_H1287 &OD->list[26]
+#define OD_ENTRY_H1288 &OD->list[27]
+#define OD_ENTRY_H1289 &OD->list[28]
+#define OD_ENTRY_H128A &OD->list[29]
+#define OD_ENTRY_H128B &OD->list[30]
+#define OD_ENTRY_H128C &OD->list[31]
+#define OD_ENTRY_H128D &OD->list[32]
+#define OD_ENTRY_H128E &OD->list[33]
+#define OD_ENTRY_H128F &OD->list[34]
+#define OD_ENTRY_H1290 &OD->list[35]
+#define OD_ENTRY_H1291 &OD->list[36]
+#define OD_ENTRY_H1292 &OD->list[37]
+#define OD_ENTRY_H1293 &OD->list[38]
+#define OD_ENTRY_H1294 &OD->list[39]
+#define OD_ENTRY_H1295 &OD->list[40]
+#define OD_ENTRY_H1296 &OD->list[41]
+#define OD_ENTRY_H1297 &OD->list[42]
+#define OD_ENTRY_H1298 &OD->list[43]
+#define OD_ENTRY_H1299 &OD->list[44]
+#define OD_ENTRY_H129A &OD->list[45]
+#define OD_ENTRY_H129B &OD->list[46]
+#define OD_ENTRY_H129C &OD->list[47]
+#define OD_ENTRY_H129D &OD->list[48]
+#define OD_ENTRY_H129E &OD->list[49]
+#define OD_ENTRY_H129F &OD->list[50]
+#define OD_ENTRY_H12A0 &OD->list[51]
+#define OD_ENTRY_H12A1 &OD->list[52]
+#define OD_ENTRY_H12A2 &OD->list[53]
+#define OD_ENTRY_H12A3 &OD->list[54]
+#define OD_ENTRY_H12A4 &OD->list[55]
+#define OD_ENTRY_H12A5 &OD->list[56]
+#define OD_ENTRY_H12A6 &OD->list[57]
+#define OD_ENTRY_H12A7 &OD->list[58]
+#define OD_ENTRY_H12A8 &OD->list[59]
+#define OD_ENTRY_H12A9 &OD->list[60]
+#define OD_ENTRY_H12AA &OD->list[61]
+#define OD_ENTRY_H12AB &OD->list[62]
+#define OD_ENTRY_H12AC &OD->list[63]
+#define OD_ENTRY_H12AD &OD->list[64]
+#define OD_ENTRY_H12AE &OD->list[65]
+#define OD_ENTRY_H12AF &OD->list[66]
+#define OD_ENTRY_H12B0 &OD->list[67]
+#define OD_ENTRY_H12B1 &OD->list[68]
+#define OD_ENTRY_H12B2 &OD->list[69]
+#define OD_ENTRY_H12B3 &OD->list[70]
+#define OD_ENTRY_H12B4 &OD->list[71]
+#define OD_ENTRY_H12B5 &OD->list[72]
+#define OD_ENTRY_H12B6 &OD->list[73]
+#define OD_ENTRY_H12B7 &OD->list[74]
+#define OD_ENTRY_H12B8 &OD->list[75]
+#define OD_ENTRY_H12B9 &OD->list[76]
+#define OD_ENTRY_H12BA &OD->list[77]
+#define OD_ENTRY_H12BB &OD->list[78]
+#define OD_ENTRY_H12BC &OD->list[79]
+#define OD_ENTRY_H12BD &OD->list[80]
+#define OD_ENTRY_H12BE &OD->list[81]
+#define OD_ENTRY_H12BF &OD->list[82]
+#define OD_ENTRY_H12C0 &OD->list[83]
+#define OD_ENTRY_H12C1 &OD->list[84]
+#define OD_ENTRY_H12C2 &OD->list[85]
+#define OD_ENTRY_H12C3 &OD->list[86]
+#define OD_ENTRY_H12C4 &OD->list[87]
+#define OD_ENTRY_H12C5 &OD->list[88]
+#define OD_ENTRY_H12C6 &OD->list[89]
+#define OD_ENTRY_H12C7 &OD->list[90]
+#define OD_ENTRY_H12C8 &OD->list[91]
+#define OD_ENTRY_H12C9 &OD->list[92]
+#define OD_ENTRY_H12CA &OD->list[93]
+#define OD_ENTRY_H12CB &OD->list[94]
+#define OD_ENTRY_H12CC &OD->list[95]
+#define OD_ENTRY_H12CD &OD->list[96]
+#define OD_ENTRY_H12CE &OD->list[97]
+#define OD_ENTRY_H12CF &OD->list[98]
+#define OD_ENTRY_H12D0 &OD->list[99]
+#define OD_ENTRY_H12D1 &OD->list[100]
+#define OD_ENTRY_H12D2 &OD->list[101]
+#define OD_ENTRY_H12D3 &OD->list[102]
+#define OD_ENTRY_H12D4 &OD->list[103]
+#define OD_ENTRY_H12D5 &OD->list[104]
+#define OD_ENTRY_H12D6 &OD->list[105]
+#define OD_ENTRY_H12D7 &OD->list[106]
+#define OD_ENTRY_H12D8 &OD->list[107]
+#define OD_ENTRY_H12D9 &OD->list[108]
+#define OD_ENTRY_H12DA &OD->list[109]
+#define OD_ENTRY_H12DB &OD->list[110]
+#define OD_ENTRY_H12DC &OD->list[111]
+#define OD_ENTRY_H12DD &OD->list[112]
+#define OD_ENTRY_H12DE &OD->list[113]
+#define OD_ENTRY_H12DF &OD->list[114]
+#define OD_ENTRY_H12E0 &OD->list[115]
+#define OD_ENTRY_H12E1 &OD->list[116]
+#define OD_ENTRY_H12E2 &OD->list[117]
+#define OD_ENTRY_H12E3 &OD->list[118]
+#define OD_ENTRY_H12E4 &OD->list[119]
+#define OD_ENTRY_H12E5 &OD->list[120]
+#define OD_ENTRY_H12E6 &OD->list[121]
+#define OD_ENTRY_H12E7 &OD->list[122]
+#define OD_ENTRY_H12E8 &OD->list[123]
+#define OD_ENTRY_H12E9 &OD->list[124]
+#define OD_ENTRY_H12EA &OD->list[125]
+#define OD_ENTRY_H12EB &OD->list[126]
+#define OD_ENTRY_H12EC &OD->list[127]
+#define OD_ENTRY_H12ED &OD->list[128]
+#define OD_ENTRY_H12EE &OD->list[129]
+#define OD_ENTRY_H12EF &OD->list[130]
+#define OD_ENTRY_H12F0 &OD->list[131]
+#define OD_ENTRY_H12F1 &OD->list[132]
+#define OD_ENTRY_H12F2 &OD->list[133]
+#define OD_ENTRY_H12F3 &OD->list[134]
+#define OD_ENTRY_H12F4 &OD->list[135]
+#define OD_ENTRY_H12F5 &OD->list[136]
+#define OD_ENTRY_H12F6 &OD->list[137]
+#define OD_ENTRY_H12F7 &OD->list[138]
+#define OD_ENTRY_H12F8 &OD->list[139]
+#define OD_ENTRY_H12F9 &OD->list[140]
+#define OD_ENTRY_H12FA &OD->list[141]
+#define OD_ENTRY_H12FB &OD->list[142]
+#define OD_ENTRY_H12FC &OD->list[143]
+#define OD_ENTRY_H12FD &OD->list[144]
+#define OD_ENTRY_H12FE &OD->list[145]
+#define OD_ENTRY_H12FF &OD->list[146]
+#define OD_ENTRY_H1400 &OD->list[147]
+#define OD_ENTRY_H1600 &OD->list[148]
+#define OD_ENTRY_H1800 &OD->list[149]
+#define OD_ENTRY_H1A00 &OD->list[150]
+#define OD_ENTRY_H1F50 &OD->list[151]
+#define OD_ENTRY_H1F51 &OD->list[152]
+#define OD_ENTRY_H1F56 &OD->list[153]
+#define OD_ENTRY_H1F57 &OD->list[154]
+#define OD_ENTRY_H6000 &OD->list[155]
+#define OD_ENTRY_H6200 &OD->list[156]
+#define OD_ENTRY_H6201 &OD->list[157]
 
 
 /*******************************************************************************
@@ -251,17 +1141,144 @@ extern OD_ATTR_OD OD_t *OD;
 #define OD_ENTRY_H1019_synchronousCounterOverflowValue &OD->list[17]
 #define OD_ENTRY_H1200_SDOServerParameter &OD->list[18]
 #define OD_ENTRY_H1280_SDOClientParameter &OD->list[19]
-#define OD_ENTRY_H1400_RPDOCommunicationParameter &OD->list[20]
-#define OD_ENTRY_H1600_RPDOMappingParameter &OD->list[21]
-#define OD_ENTRY_H1800_TPDOCommunicationParameter &OD->list[22]
-#define OD_ENTRY_H1A00_TPDOMappingParameter &OD->list[23]
-#define OD_ENTRY_H1F50_newFirmware &OD->list[24]
-#define OD_ENTRY_H1F51_programControl &OD->list[25]
-#define OD_ENTRY_H1F56_appSoftIdentification &OD->list[26]
-#define OD_ENTRY_H1F57_flashStatusIdentification &OD->list[27]
-#define OD_ENTRY_H6000_power &OD->list[28]
-#define OD_ENTRY_H6200_sys_pwr_sensors &OD->list[29]
-#define OD_ENTRY_H6201_th_sensors &OD->list[30]
+#define OD_ENTRY_H1281_SDOClientParameter &OD->list[20]
+#define OD_ENTRY_H1282_SDOClientParameter &OD->list[21]
+#define OD_ENTRY_H1283_SDOClientParameter &OD->list[22]
+#define OD_ENTRY_H1284_SDOClientParameter &OD->list[23]
+#define OD_ENTRY_H1285_SDOClientParameter &OD->list[24]
+#define OD_ENTRY_H1286_SDOClientParameter &OD->list[25]
+#define OD_ENTRY_H1287_SDOClientParameter &OD->list[26]
+#define OD_ENTRY_H1288_SDOClientParameter &OD->list[27]
+#define OD_ENTRY_H1289_SDOClientParameter &OD->list[28]
+#define OD_ENTRY_H128A_SDOClientParameter &OD->list[29]
+#define OD_ENTRY_H128B_SDOClientParameter &OD->list[30]
+#define OD_ENTRY_H128C_SDOClientParameter &OD->list[31]
+#define OD_ENTRY_H128D_SDOClientParameter &OD->list[32]
+#define OD_ENTRY_H128E_SDOClientParameter &OD->list[33]
+#define OD_ENTRY_H128F_SDOClientParameter &OD->list[34]
+#define OD_ENTRY_H1290_SDOClientParameter &OD->list[35]
+#define OD_ENTRY_H1291_SDOClientParameter &OD->list[36]
+#define OD_ENTRY_H1292_SDOClientParameter &OD->list[37]
+#define OD_ENTRY_H1293_SDOClientParameter &OD->list[38]
+#define OD_ENTRY_H1294_SDOClientParameter &OD->list[39]
+#define OD_ENTRY_H1295_SDOClientParameter &OD->list[40]
+#define OD_ENTRY_H1296_SDOClientParameter &OD->list[41]
+#define OD_ENTRY_H1297_SDOClientParameter &OD->list[42]
+#define OD_ENTRY_H1298_SDOClientParameter &OD->list[43]
+#define OD_ENTRY_H1299_SDOClientParameter &OD->list[44]
+#define OD_ENTRY_H129A_SDOClientParameter &OD->list[45]
+#define OD_ENTRY_H129B_SDOClientParameter &OD->list[46]
+#define OD_ENTRY_H129C_SDOClientParameter &OD->list[47]
+#define OD_ENTRY_H129D_SDOClientParameter &OD->list[48]
+#define OD_ENTRY_H129E_SDOClientParameter &OD->list[49]
+#define OD_ENTRY_H129F_SDOClientParameter &OD->list[50]
+#define OD_ENTRY_H12A0_SDOClientParameter &OD->list[51]
+#define OD_ENTRY_H12A1_SDOClientParameter &OD->list[52]
+#define OD_ENTRY_H12A2_SDOClientParameter &OD->list[53]
+#define OD_ENTRY_H12A3_SDOClientParameter &OD->list[54]
+#define OD_ENTRY_H12A4_SDOClientParameter &OD->list[55]
+#define OD_ENTRY_H12A5_SDOClientParameter &OD->list[56]
+#define OD_ENTRY_H12A6_SDOClientParameter &OD->list[57]
+#define OD_ENTRY_H12A7_SDOClientParameter &OD->list[58]
+#define OD_ENTRY_H12A8_SDOClientParameter &OD->list[59]
+#define OD_ENTRY_H12A9_SDOClientParameter &OD->list[60]
+#define OD_ENTRY_H12AA_SDOClientParameter &OD->list[61]
+#define OD_ENTRY_H12AB_SDOClientParameter &OD->list[62]
+#define OD_ENTRY_H12AC_SDOClientParameter &OD->list[63]
+#define OD_ENTRY_H12AD_SDOClientParameter &OD->list[64]
+#define OD_ENTRY_H12AE_SDOClientParameter &OD->list[65]
+#define OD_ENTRY_H12AF_SDOClientParameter &OD->list[66]
+#define OD_ENTRY_H12B0_SDOClientParameter &OD->list[67]
+#define OD_ENTRY_H12B1_SDOClientParameter &OD->list[68]
+#define OD_ENTRY_H12B2_SDOClientParameter &OD->list[69]
+#define OD_ENTRY_H12B3_SDOClientParameter &OD->list[70]
+#define OD_ENTRY_H12B4_SDOClientParameter &OD->list[71]
+#define OD_ENTRY_H12B5_SDOClientParameter &OD->list[72]
+#define OD_ENTRY_H12B6_SDOClientParameter &OD->list[73]
+#define OD_ENTRY_H12B7_SDOClientParameter &OD->list[74]
+#define OD_ENTRY_H12B8_SDOClientParameter &OD->list[75]
+#define OD_ENTRY_H12B9_SDOClientParameter &OD->list[76]
+#define OD_ENTRY_H12BA_SDOClientParameter &OD->list[77]
+#define OD_ENTRY_H12BB_SDOClientParameter &OD->list[78]
+#define OD_ENTRY_H12BC_SDOClientParameter &OD->list[79]
+#define OD_ENTRY_H12BD_SDOClientParameter &OD->list[80]
+#define OD_ENTRY_H12BE_SDOClientParameter &OD->list[81]
+#define OD_ENTRY_H12BF_SDOClientParameter &OD->list[82]
+#define OD_ENTRY_H12C0_SDOClientParameter &OD->list[83]
+#define OD_ENTRY_H12C1_SDOClientParameter &OD->list[84]
+#define OD_ENTRY_H12C2_SDOClientParameter &OD->list[85]
+#define OD_ENTRY_H12C3_SDOClientParameter &OD->list[86]
+#define OD_ENTRY_H12C4_SDOClientParameter &OD->list[87]
+#define OD_ENTRY_H12C5_SDOClientParameter &OD->list[88]
+#define OD_ENTRY_H12C6_SDOClientParameter &OD->list[89]
+#define OD_ENTRY_H12C7_SDOClientParameter &OD->list[90]
+#define OD_ENTRY_H12C8_SDOClientParameter &OD->list[91]
+#define OD_ENTRY_H12C9_SDOClientParameter &OD->list[92]
+#define OD_ENTRY_H12CA_SDOClientParameter &OD->list[93]
+#define OD_ENTRY_H12CB_SDOClientParameter &OD->list[94]
+#define OD_ENTRY_H12CC_SDOClientParameter &OD->list[95]
+#define OD_ENTRY_H12CD_SDOClientParameter &OD->list[96]
+#define OD_ENTRY_H12CE_SDOClientParameter &OD->list[97]
+#define OD_ENTRY_H12CF_SDOClientParameter &OD->list[98]
+#define OD_ENTRY_H12D0_SDOClientParameter &OD->list[99]
+#define OD_ENTRY_H12D1_SDOClientParameter &OD->list[100]
+#define OD_ENTRY_H12D2_SDOClientParameter &OD->list[101]
+#define OD_ENTRY_H12D3_SDOClientParameter &OD->list[102]
+#define OD_ENTRY_H12D4_SDOClientParameter &OD->list[103]
+#define OD_ENTRY_H12D5_SDOClientParameter &OD->list[104]
+#define OD_ENTRY_H12D6_SDOClientParameter &OD->list[105]
+#define OD_ENTRY_H12D7_SDOClientParameter &OD->list[106]
+#define OD_ENTRY_H12D8_SDOClientParameter &OD->list[107]
+#define OD_ENTRY_H12D9_SDOClientParameter &OD->list[108]
+#define OD_ENTRY_H12DA_SDOClientParameter &OD->list[109]
+#define OD_ENTRY_H12DB_SDOClientParameter &OD->list[110]
+#define OD_ENTRY_H12DC_SDOClientParameter &OD->list[111]
+#define OD_ENTRY_H12DD_SDOClientParameter &OD->list[112]
+#define OD_ENTRY_H12DE_SDOClientParameter &OD->list[113]
+#define OD_ENTRY_H12DF_SDOClientParameter &OD->list[114]
+#define OD_ENTRY_H12E0_SDOClientParameter &OD->list[115]
+#define OD_ENTRY_H12E1_SDOClientParameter &OD->list[116]
+#define OD_ENTRY_H12E2_SDOClientParameter &OD->list[117]
+#define OD_ENTRY_H12E3_SDOClientParameter &OD->list[118]
+#define OD_ENTRY_H12E4_SDOClientParameter &OD->list[119]
+#define OD_ENTRY_H12E5_SDOClientParameter &OD->list[120]
+#define OD_ENTRY_H12E6_SDOClientParameter &OD->list[121]
+#define OD_ENTRY_H12E7_SDOClientParameter &OD->list[122]
+#define OD_ENTRY_H12E8_SDOClientParameter &OD->list[123]
+#define OD_ENTRY_H12E9_SDOClientParameter &OD->list[124]
+#define OD_ENTRY_H12EA_SDOClientParameter &OD->list[125]
+#define OD_ENTRY_H12EB_SDOClientParameter &OD->list[126]
+#define OD_ENTRY_H12EC_SDOClientParameter &OD->list[127]
+#define OD_ENTRY_H12ED_SDOClientParameter &OD->list[128]
+#define OD_ENTRY_H12EE_SDOClientParameter &OD->list[129]
+#define OD_ENTRY_H12EF_SDOClientParameter &OD->list[130]
+#define OD_ENTRY_H12F0_SDOClientParameter &OD->list[131]
+#define OD_ENTRY_H12F1_SDOClientParameter &OD->list[132]
+#define OD_ENTRY_H12F2_SDOClientParameter &OD->list[133]
+#define OD_ENTRY_H12F3_SDOClientParameter &OD->list[134]
+#define OD_ENTRY_H12F4_SDOClientParameter &OD->list[135]
+#define OD_ENTRY_H12F5_SDOClientParameter &OD->list[136]
+#define OD_ENTRY_H12F6_SDOClientParameter &OD->list[137]
+#define OD_ENTRY_H12F7_SDOClientParameter &OD->list[138]
+#define OD_ENTRY_H12F8_SDOClientParameter &OD->list[139]
+#define OD_ENTRY_H12F9_SDOClientParameter &OD->list[140]
+#define OD_ENTRY_H12FA_SDOClientParameter &OD->list[141]
+#define OD_ENTRY_H12FB_SDOClientParameter &OD->list[142]
+#define OD_ENTRY_H12FC_SDOClientParameter &OD->list[143]
+#define OD_ENTRY_H12FD_SDOClientParameter &OD->list[144]
+#define OD_ENTRY_H12FE_SDOClientParameter &OD->list[145]
+#define OD_ENTRY_H12FF_SDOClientParameter &OD->list[146]
+#define OD_ENTRY_H1400_RPDOCommunicationParameter &OD->list[147]
+#define OD_ENTRY_H1600_RPDOMappingParameter &OD->list[148]
+#define OD_ENTRY_H1800_TPDOCommunicationParameter &OD->list[149]
+#define OD_ENTRY_H1A00_TPDOMappingParameter &OD->list[150]
+#define OD_ENTRY_H1F50_newFirmware &OD->list[151]
+#define OD_ENTRY_H1F51_programControl &OD->list[152]
+#define OD_ENTRY_H1F56_appSoftIdentification &OD->list[153]
+#define OD_ENTRY_H1F57_flashStatusIdentification &OD->list[154]
+#define OD_ENTRY_H6000_power &OD->list[155]
+#define OD_ENTRY_H6200_sys_pwr_sensors &OD->list[156]
+#define OD_ENTRY_H6201_th_sensors &OD->list[157]
 
 
 /*******************************************************************************
@@ -0,0 +1,246 @@
+#define OD_DEFINITION // OD_obj_var_t and friends
+#include "co_od.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CO_OD_ALIGN(x) (((x) + 7u) & ~(size_t)7u)
+
+// Bump allocator: a pass without base only measures, the second one fills the block
+typedef struct
+{
+	uint8_t *base;
+	size_t used;
+} od_arena_t;
+
+static void *take(od_arena_t *a, size_t size)
+{
+	void *p = a->base ? a->base + a->used : NULL;
+	a->used += CO_OD_ALIGN(size);
+	return p;
+}
+
+static void *take_copy(od_arena_t *a, const void *src, size_t size)
+{
+	if(!src) return NULL;		  // domain without data
+	void *p = take(a, size + 1); // + 1: strings stay terminated, the block is zeroed
+	if(p) memcpy(p, src, size);
+	return p;
+}
+
+static OD_t *copy(od_arena_t *a, const OD_t *od)
+{
+	OD_t *out = take(a, sizeof(*out));
+	OD_entry_t *list = take(a, (od->size + 1u) * sizeof(*list)); // blank last element as in generated lists
+	if(out)
+	{
+		out->size = od->size;
+		out->list = list;
+	}
+	for(uint16_t i = 0; i < od->size; i++)
+	{
+		const OD_entry_t *e = &od->list[i];
+		void *obj = NULL;
+		switch(e->odObjectType & ODT_TYPE_MASK)
+		{
+		case ODT_VAR:
+		{
+			const OD_obj_var_t *v = e->odObject;
+			OD_obj_var_t *c = take(a, sizeof(*c));
+			void *data = take_copy(a, v->dataOrig, v->dataLength);
+			if(c)
+			{
+				*c = *v;
+				c->dataOrig = data;
+			}
+			obj = c;
+			break;
+		}
+		case ODT_ARR:
+		{
+			const OD_obj_array_t *v = e->odObject;
+			OD_obj_array_t *c = take(a, sizeof(*c));
+			uint8_t *data0 = take_copy(a, v->dataOrig0, 1);
+			void *data = take_copy(a, v->dataOrig, (size_t)v->dataElementSizeof * (e->subEntriesCount - 1u));
+			if(c)
+			{
+				*c = *v;
+				c->dataOrig0 = data0;
+				c->dataOrig = data;
+			}
+			obj = c;
+			break;
+		}
+		case ODT_REC:
+		{
+			const OD_obj_record_t *v = e->odObject;
+			OD_obj_record_t *c = take(a, e->subEntriesCount * sizeof(*c));
+			for(uint8_t s = 0; s < e->subEntriesCount; s++)
+			{
+				void *data = take_copy(a, v[s].dataOrig, v[s].dataLength);
+				if(c)
+				{
+					c[s] = v[s];
+					c[s].dataOrig = data;
+				}
+			}
+			obj = c;
+			break;
+		}
+		default: // unknown type: the entry stays without object, OD_getSub() reports it missing
+			break;
+		}
+		if(list)
+		{
+			list[i] = *e;
+			list[i].odObject = obj;
+			list[i].extension = NULL; // the stack of the new instance registers its own
+		}
+	}
+	return out;
+}
+
+// Direct index of od: the page table and one 256 slot table per page with objects
+static OD_lut_t *lut(od_arena_t *a, const OD_t *od)
+{
+	OD_lut_t *l = take(a, sizeof(*l));
+	uint16_t *slot = NULL;
+	for(uint16_t i = 0; i < od->size; i++)
+	{
+		const uint16_t index = od->list[i].index;
+		if(!i || od->list[i - 1].index >> 8 != index >> 8) // list is sorted: pages come in runs
+		{
+			slot = take(a, 256 * sizeof(*slot));
+			if(!l) continue;
+			memset(slot, 0xFF, 256 * sizeof(*slot)); // OD_LUT_NONE
+			l->page[index >> 8] = slot;
+		}
+		if(l) slot[index & 0xFF] = i;
+	}
+	return l;
+}
+
+OD_t *co_od_clone(const OD_t *od)
+{
+	od_arena_t a = {0};
+	copy(&a, od);
+	lut(&a, od);
+	a.base = calloc(1, a.used);
+	if(!a.base) return NULL;
+	a.used = 0;
+	OD_t *out = copy(&a, od); // OD_t first: its address is the block
+	out->lut = lut(&a, od);
+	return out;
+}
+
+void co_od_free(OD_t *od) { free(od); }
+
+int co_od_lut_init(OD_t *od)
+{
+	if(od->lut) return 0;
+	od_arena_t a = {0};
+	lut(&a, od);
+	a.base = calloc(1, a.used);
+	if(!a.base) return -1;
+	a.used = 0;
+	od->lut = lut(&a, od);
+	return 0;
+}
+
+void co_od_lut_deinit(OD_t *od)
+{
+	free((void *)(uintptr_t)od->lut);
+	od->lut = NULL;
+}
+
+ODR_t co_od_h_init(co_od_h_t *h, OD_t *od, uint16_t index, uint8_t sub, OD_size_t size)
+{
+	memset(h, 0, sizeof(*h));
+	const ODR_t ret = OD_getSub(OD_find(od, index), sub, &h->io, false);
+	if(ret != ODR_OK) return ret;
+	const OD_stream_t *s = &h->io.stream;
+	if(s->dataLength != size || (s->attribute & ODA_STR) || (size > 1 && !(s->attribute & ODA_MB))) return ODR_TYPE_MISMATCH;
+	h->var = s->dataOrig;
+	if(!h->var) // extension only
+		return h->io.read == OD_readOriginal && h->io.write == OD_writeOriginal ? ODR_DEV_INCOMPAT : ODR_OK;
+	if(h->io.read == OD_readOriginal) h->io.read = NULL;
+	if(h->io.write == OD_writeOriginal) h->io.write = NULL;
+	return ODR_OK;
+}
+
+ODR_t co_od_h_read(co_od_h_t *h, void *val, OD_size_t size)
+{
+	OD_size_t cnt = 0;
+	OD_rwRestart(&h->io.stream);
+	return h->io.read(&h->io.stream, val, size, &cnt);
+}
+
+ODR_t co_od_h_write(co_od_h_t *h, const void *val, OD_size_t size)
+{
+	OD_size_t cnt = 0;
+	OD_rwRestart(&h->io.stream);
+	return h->io.write(&h->io.stream, val, size, &cnt);
+}
+
+#ifdef CO_MULTIPLE_OD
+// Objects first, first + 1, ... present, like 0x1400.. RPDO communication parameters
+static uint16_t count_run(OD_t *od, uint16_t first, uint16_t max)
+{
+	uint16_t n = 0;
+	while(n < max && OD_find(od, (uint16_t)(first + n))) n++;
+	return n;
+}
+
+static uint8_t count_arr(const OD_entry_t *e) { return e && e->subEntriesCount ? (uint8_t)(e->subEntriesCount - 1u) : 0; }
+
+void co_od_config(CO_config_t *config, OD_t *od)
+{
+	memset(config, 0, sizeof(*config));
+	config->CNT_NMT = 1;
+	config->ENTRY_H1017 = OD_find(od, 0x1017);
+	config->ENTRY_H1016 = OD_find(od, 0x1016);
+	config->CNT_ARR_1016 = count_arr(config->ENTRY_H1016);
+	config->CNT_HB_CONS = config->CNT_ARR_1016 ? 1 : 0;
+	config->CNT_EM = 1;
+	config->ENTRY_H1001 = OD_find(od, 0x1001);
+	config->ENTRY_H1014 = OD_find(od, 0x1014);
+	config->ENTRY_H1015 = OD_find(od, 0x1015);
+	config->ENTRY_H1003 = OD_find(od, 0x1003);
+	config->CNT_ARR_1003 = count_arr(config->ENTRY_H1003);
+	config->ENTRY_H1200 = OD_find(od, 0x1200);
+	config->CNT_SDO_SRV = (uint8_t)count_run(od, 0x1200, 128);
+	config->ENTRY_H1280 = OD_find(od, 0x1280);
+	config->CNT_SDO_CLI = (uint8_t)count_run(od, 0x1280, 128);
+	config->ENTRY_H1012 = OD_find(od, 0x1012);
+	config->CNT_TIME = config->ENTRY_H1012 ? 1 : 0;
+	config->ENTRY_H1005 = OD_find(od, 0x1005);
+	config->ENTRY_H1006 = OD_find(od, 0x1006);
+	config->ENTRY_H1007 = OD_find(od, 0x1007);
+	config->ENTRY_H1019 = OD_find(od, 0x1019);
+	config->CNT_SYNC = config->ENTRY_H1005 ? 1 : 0;
+	config->ENTRY_H1400 = OD_find(od, 0x1400);
+	config->ENTRY_H1600 = OD_find(od, 0x1600);
+	config->CNT_RPDO = count_run(od, 0x1400, 512);
+	config->ENTRY_H1800 = OD_find(od, 0x1800);
+	config->ENTRY_H1A00 = OD_find(od, 0x1A00);
+	config->CNT_TPDO = count_run(od, 0x1800, 512);
+	config->ENTRY_H1300 = OD_find(od, 0x1300);
+	config->CNT_GFC = config->ENTRY_H1300 ? 1 : 0;
+	config->ENTRY_H1301 = OD_find(od, 0x1301);
+	config->ENTRY_H1381 = OD_find(od, 0x1381);
+	config->ENTRY_H13FE = OD_find(od, 0x13FE);
+	config->ENTRY_H13FF = OD_find(od, 0x13FF);
+	config->CNT_SRDO = (uint8_t)count_run(od, 0x1301, 64);
+#if(CO_CONFIG_LEDS) & CO_CONFIG_LEDS_ENABLE
+	config->CNT_LEDS = 1;
+#endif
+#if(CO_CONFIG_LSS) & CO_CONFIG_LSS_SLAVE
+	config->CNT_LSS_SLV = 1;
+#endif
+#if(CO_CONFIG_LSS) & CO_CONFIG_LSS_MASTER
+	config->CNT_LSS_MST = 1;
+#endif
+#if(CO_CONFIG_GTW) & CO_CONFIG_GTW_ASCII
+	config->CNT_GTWA = 1;
+#endif
+}
+#endif
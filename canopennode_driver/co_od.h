@@ -0,0 +1,79 @@
+#ifndef CO_OD_H__
+#define CO_OD_H__
+
+#include "CANopen.h"
+
+/**
+ * Per-instance object dictionaries: several CO_t in one process each need their own copy of the OD data
+ * (node-ID dependent COB-IDs, heartbeat tables, extensions set by the stack). With CO_MULTIPLE_OD the
+ * CO_new() configuration is taken from the copy instead of the OD_CNT_* and OD_ENTRY_H* macros of OD.h.
+ */
+
+// Deep copy of od: own entry list and data (current values of od), no extensions, direct index (OD_lut_t) for
+// OD_find(). One allocation, NULL without memory
+OD_t *co_od_clone(const OD_t *od);
+void co_od_free(OD_t *od);
+
+// Direct index for OD_find() of an OD that has none yet (od_gen -n output, CANopenEditor output), 0 or -1 without
+// memory. The list must be sorted and stay as it is. Deinit only what init built, never a clone or an od_gen index
+int co_od_lut_init(OD_t *od);
+void co_od_lut_deinit(OD_t *od);
+
+// Handle of one OD variable resolved once: loads and stores go straight to the variable, through the extension of
+// the entry only where it has its own read/write (OD_readOriginal/OD_writeOriginal count as none). Resolve after
+// CO_CANopenInit() and CO_storage_track(), they set the extensions. No OD lock, like OD_get_*/OD_set_*; one thread
+// per handle
+typedef struct
+{
+	void *var;	// the variable in the OD, NULL if the OD has no memory for it
+	OD_IO_t io; // extension, io.read/io.write NULL: var directly
+} co_od_h_t;
+
+// Numeric variable of size bytes at index/sub of od: ODR_OK, ODR_IDX_NOT_EXIST, ODR_SUB_NOT_EXIST, ODR_TYPE_MISMATCH
+// (length, string, domain) or ODR_DEV_INCOMPAT (neither memory nor extension)
+ODR_t co_od_h_init(co_od_h_t *h, OD_t *od, uint16_t index, uint8_t sub, OD_size_t size);
+// Through the extension, the typed accessors call them only when io.read/io.write is set
+ODR_t co_od_h_read(co_od_h_t *h, void *val, OD_size_t size);
+ODR_t co_od_h_write(co_od_h_t *h, const void *val, OD_size_t size);
+
+// Typed handles: co_od_u32_init(&h, od, 0x1016, 1), v = co_od_u32_get(&h) (0 if the extension refuses the read),
+// co_od_u32_set(&h, v)
+#define CO_OD_H_TYPE(T, t)                                                                                                     \
+	typedef struct                                                                                                             \
+	{                                                                                                                          \
+		co_od_h_t h;                                                                                                           \
+	} co_od_##T##_t;                                                                                                           \
+	static inline ODR_t co_od_##T##_init(co_od_##T##_t *h, OD_t *od, uint16_t index, uint8_t sub)                              \
+	{                                                                                                                          \
+		return co_od_h_init(&h->h, od, index, sub, sizeof(t));                                                                 \
+	}                                                                                                                          \
+	static inline t co_od_##T##_get(co_od_##T##_t *h)                                                                          \
+	{                                                                                                                          \
+		if(!h->h.io.read) return *(const t *)h->h.var;                                                                         \
+		t v = 0;                                                                                                               \
+		return co_od_h_read(&h->h, &v, sizeof(v)) == ODR_OK ? v : 0;                                                           \
+	}                                                                                                                          \
+	static inline ODR_t co_od_##T##_set(co_od_##T##_t *h, t v)                                                                 \
+	{                                                                                                                          \
+		if(h->h.io.write) return co_od_h_write(&h->h, &v, sizeof(v));                                                          \
+		*(t *)h->h.var = v;                                                                                                    \
+		return ODR_OK;                                                                                                         \
+	}
+
+CO_OD_H_TYPE(u8, uint8_t)
+CO_OD_H_TYPE(i8, int8_t)
+CO_OD_H_TYPE(u16, uint16_t)
+CO_OD_H_TYPE(i16, int16_t)
+CO_OD_H_TYPE(u32, uint32_t)
+CO_OD_H_TYPE(i32, int32_t)
+CO_OD_H_TYPE(u64, uint64_t)
+CO_OD_H_TYPE(i64, int64_t)
+CO_OD_H_TYPE(r32, float32_t)
+CO_OD_H_TYPE(r64, float64_t)
+
+#ifdef CO_MULTIPLE_OD
+// Object counts and entries for CO_new() from the objects present in od, LSS/gateway/LEDs from CO_CONFIG_*
+void co_od_config(CO_config_t *config, OD_t *od);
+#endif
+
+#endif // CO_OD_H__
@@ -3,8 +3,6 @@
 #include "301/CO_driver.h"
 #include <string.h>
 
-extern uint8_t g_active_can_node_id;
-
 #ifdef CO_CONFIG_TERM
 
 #ifdef CO_CONFIG_TERM_LISTENER
@@ -17,12 +15,13 @@ static void term_rx(void *obj, void *msg)
 #endif
 
 #ifdef CO_CONFIG_TERM_REQUESTER
-void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, CO_CANtx_t *co_time_tx_buf)
+void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, uint8_t node_id, CO_CANtx_t *co_time_tx_buf)
 #else
-void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module)
+void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, uint8_t node_id)
 #endif
 {
 	t->module = co_module;
+	t->node_id = node_id;
 	t->rx_cnt = 0;
 	RB_INIT(t->tx_info);
 
@@ -34,7 +33,7 @@ void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module)
 	t->co_term_tx_buf = CO_CANtxBufferInit(
 		co_module,					  /* CAN device */
 		co_module->txSize - 1,		  /* index of specific buffer inside CAN module */
-		0x100 + g_active_can_node_id, /* CAN identifier */
+		0x100 + node_id,			  /* CAN identifier */
 		0,							  /* rtr */
 		8,							  /* number of data bytes */
 		0);							  /* synchronous message flag bit */
@@ -54,7 +53,7 @@ void co_term_append_req(CO_term_t *t, const uint8_t *data, uint8_t dlc)
 {
 	if(dlc > 1)
 	{
-		if(g_active_can_node_id == data[0]) // msg match
+		if(t->node_id == data[0]) // msg match
 		{
 			for(uint32_t i = 1; i < dlc; i++)
 			{
@@ -23,6 +23,7 @@ typedef struct
 	CO_CANmodule_t *module;
 	CO_CANtx_t *co_term_tx_buf;
 #ifdef CO_CONFIG_TERM
+	uint8_t node_id; // info COB-ID 0x100 + node_id, requests addressed to it
 
 #ifdef CO_CONFIG_TERM_REQUESTER
 	CO_CANtx_t *co_time_tx_buf;
@@ -38,9 +39,9 @@ typedef struct
 } CO_term_t;
 
 #ifdef CO_CONFIG_TERM_REQUESTER
-void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, CO_CANtx_t *co_time_tx_buf);
+void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, uint8_t node_id, CO_CANtx_t *co_time_tx_buf);
 #else
-void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module);
+void co_term_init(CO_term_t *t, CO_CANmodule_t *co_module, uint8_t node_id);
 #endif
 void co_term_append_req(CO_term_t *t, const uint8_t *data, uint8_t dlc);
 void co_term_send(CO_term_t *t, const uint8_t *data, uint32_t len);
@@ -73,11 +74,11 @@ extern void co_term_listener_rx(CO_term_t *t, uint8_t id, const uint8_t *data, u
  * insert CANOPEN_TIME_TERMINAL_MACRO(); to CO_TIME.c
  * insert #include "co_term.h" and CO_term_t *t; to CO_TIME.h
  * insert #include "co_term.h" and #ifdef CO_CONFIG_TERM CO_term_t term; #endif to CANopen.h
- * modify #define CO_CNT_ALL_TX_MSGS in CANopen.c
- * modify #define CO_CNT_ALL_RX_MSGS in CANopen.c
+ * modify #define CO_CNT_ALL_TX_MSGS in CANopen.c (and idxTx in CO_new() for CO_MULTIPLE_OD)
+ * modify #define CO_CNT_ALL_RX_MSGS in CANopen.c (and idxRx in CO_new() for CO_MULTIPLE_OD)
  *
 			CO->TIME->t = &CO->term;
-			co_term_init(&CO->term, CO->CANmodule);
+			co_term_init(&CO->term, CO->CANmodule, CO->activeNodeId);
  *
  * define in Makefile
 CO_CONFIG_TERM
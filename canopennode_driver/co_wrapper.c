@@ -2,34 +2,27 @@
 #include "301/CO_HBconsumer.h"
 #include "CANopen.h"
 #include "CO_driver_target.h"
-#include "OD.h"
+#include <OD.h> // not "OD.h": a build may supply its own OD ahead of ours
+#include "co_od.h"
 #include "co_term.h"
 #include "sp.h"
+#include <stdlib.h>
 #include <sys/time.h>
 
-#define TUNE_DELAY 10
+#define TUNE_MAX_SLEEP_US 100000 // upper bound for objects that don't report timerNext_us (TIME, terminal)
+#define TUNE_TX_RETRY_US 1000	 // port didn't accept all queued frames
 
 #define TIME_DELTA_US(x, y) ((x.tv_sec - y.tv_sec) * 1000000LL + (x.tv_usec - y.tv_usec))
 
 #ifdef _WIN32
 #include <windows.h>
-#define SLEEP_MS(msecs) Sleep(msecs)
 #else
-#include <errno.h>
-#include <time.h>
-#define SLEEP_MS(msecs)                                                            \
-	struct timespec ts = {.tv_sec = msecs / 1000, .tv_nsec = msecs % 1000 * 1000}; \
-	int res;                                                                       \
-	do                                                                             \
-	{                                                                              \
-		errno = 0;                                                                 \
-		res = nanosleep(&ts, NULL);                                                \
-	} while(res != 0 && errno == EINTR)
-#endif
-
-uint8_t g_active_can_node_id = 2;		/* Copied from CO_pending_can_node_id in the communication reset section */
-static uint8_t pending_can_node_id = 2; /* read from nonvolatile memory, configurable by LSS slave */
-static uint16_t pending_can_baud = 500; /* read from nonvolatile memory, configurable by LSS slave */
+#include <sys/eventfd.h>
+#include <sys/select.h>
+#include <unistd.h>
+#endif
+
+static const co_wrapper_cfg_t cfg_default = {.node_id = 2, .baud = 500, .hb_cons_ms = 2500};
 
 #define NMT_CONTROL                  \
 	(CO_NMT_STARTUP_TO_OPERATIONAL | \
@@ -38,6 +31,25 @@ static uint16_t pending_can_baud = 500; /* read from nonvolatile memory, configu
 	 CO_ERR_REG_GENERIC_ERR |        \
 	 CO_ERR_REG_COMMUNICATION)
 
+/* Sleep until timeout_us expires or CO_CANmodule_wakeup() is called */
+static void thr_wait(CO_CANmodule_t *m, uint32_t timeout_us)
+{
+#if defined(_WIN32)
+	WaitForSingleObject(m->thr_evt, (timeout_us + 999) / 1000);
+#else
+	fd_set rfds;
+	FD_ZERO(&rfds);
+	FD_SET(m->thr_evt, &rfds);
+	struct timeval tv = {.tv_sec = timeout_us / 1000000, .tv_usec = timeout_us % 1000000};
+	if(select(m->thr_evt + 1, &rfds, 0, 0, &tv) > 0)
+	{
+		uint64_t v;
+		ssize_t r = read(m->thr_evt, &v, sizeof(v));
+		(void)r;
+	}
+#endif
+}
+
 #if defined(_WIN32)
 #include <process.h>
 static unsigned int __stdcall thr_poll(void *data)
@@ -52,11 +64,29 @@ static void *thr_rcv(void *data)
 	{
 		tprev = tnow;
 		gettimeofday(&tnow, NULL);
-		CO_process(co, false, TIME_DELTA_US(tnow, tprev), NULL);
+		const uint32_t dt = TIME_DELTA_US(tnow, tprev);
+		uint32_t timer_next_us = TUNE_MAX_SLEEP_US;
+		CO_process(co, false, dt, &timer_next_us);
+#if(CO_CONFIG_SYNC) & CO_CONFIG_SYNC_ENABLE
+		const bool_t sync_was = CO_process_SYNC(co, dt, &timer_next_us); // clears pending sync PDOs outside the window
+#else
+		const bool_t sync_was = false;
+#endif
+#if(CO_CONFIG_PDO) & CO_CONFIG_RPDO_ENABLE
+		CO_process_RPDO(co, sync_was, dt, &timer_next_us);
+#endif
+#if(CO_CONFIG_PDO) & CO_CONFIG_TPDO_ENABLE
+		CO_process_TPDO(co, sync_was, dt, &timer_next_us);
+#endif
+		(void)sync_was;
 #ifdef CO_CONFIG_TERM
 		co_term_poll(&co->term);
 #endif
-		SLEEP_MS(TUNE_DELAY);
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+		co_sdo_async_poll(&co->sdo_async, dt, &timer_next_us);
+#endif
+		if(CO_CANmodule_flush(co->CANmodule) && timer_next_us > TUNE_TX_RETRY_US) timer_next_us = TUNE_TX_RETRY_US;
+		thr_wait(co->CANmodule, timer_next_us);
 	}
 #if !defined(_WIN32)
 	co->CANmodule->thr_exited = true;
@@ -64,64 +94,214 @@ static void *thr_rcv(void *data)
 	return 0;
 }
 
-int co_wrapper_init(CO_t **co, sp_t *sp)
+// Object dictionary of the instance: values by index, the generated OD_PERSIST_COMM is only the global one
+static CO_ReturnError_t od_setup(OD_t *od, const co_wrapper_cfg_t *cfg)
+{
+	OD_entry_t *e = OD_find(od, 0x1017);
+	if(e && OD_set_u16(e, 0, cfg->hb_ms, true) != ODR_OK) return CO_ERROR_OD_PARAMETERS;
+	e = OD_find(od, 0x1016);
+	for(uint8_t i = 1; e && i < e->subEntriesCount; i++)
+		if(OD_set_u32(e, i, cfg->hb_cons_ms ? ((uint32_t)i << 16) | cfg->hb_cons_ms : 0, true) != ODR_OK) return CO_ERROR_OD_PARAMETERS;
+	return CO_ERROR_NO;
+}
+
+// 0x1016 subs 1..cnt resolved once, the OD lives as long as the instance
+struct co_wrapper_hb_cons
 {
+	uint8_t cnt;
+	struct
+	{
+		co_od_u32_t h;
+		bool ok; // sub present with memory or extension
+	} sub[];
+};
+
+static CO_ReturnError_t hb_cons_init(CO_t *co)
+{
+	OD_entry_t *e = OD_find(co->od, 0x1016);
+	const uint8_t cnt = e && e->subEntriesCount ? e->subEntriesCount - 1 : 0;
+	co->hb_cons = calloc(1, sizeof(*co->hb_cons) + cnt * sizeof(co->hb_cons->sub[0]));
+	if(!co->hb_cons) return CO_ERROR_OUT_OF_MEMORY;
+	co->hb_cons->cnt = cnt;
+	for(uint8_t i = 0; i < cnt; i++)
+		co->hb_cons->sub[i].ok = co_od_u32_init(&co->hb_cons->sub[i].h, co->od, 0x1016, i + 1) == ODR_OK;
+	return CO_ERROR_NO;
+}
+
+bool co_wrapper_hb_cons_ms(CO_t *co, uint8_t idx, uint16_t *ms)
+{
+	if(!co->hb_cons || idx >= co->hb_cons->cnt || !co->hb_cons->sub[idx].ok) return false;
+	*ms = co_od_u32_get(&co->hb_cons->sub[idx].h) & 0xFFFF;
+	return true;
+}
+
+// Everything co_wrapper_init_drv() set up besides the thread, also after a failed init
+static void co_wrapper_free(CO_t *co)
+{
+#if defined(_WIN32)
+	if(co->CANmodule->thr_evt) CloseHandle(co->CANmodule->thr_evt);
+	DeleteCriticalSection(&co->CANmodule->tx.lock);
+#else
+	if(co->CANmodule->thr_evt >= 0) close(co->CANmodule->thr_evt);
+	pthread_mutex_destroy(&co->CANmodule->tx.lock);
+#endif
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+	co_sdo_async_deinit(&co->sdo_async);
+#endif
+	free(co->hb_cons);
+	co->hb_cons = NULL;
+	CO_delete(co);
+}
+
+static int co_wrapper_init_drv(CO_t **co, void *CANptr, const CO_CANdrv_t *drv, const co_wrapper_cfg_t *cfg)
+{
+	if(!cfg) cfg = &cfg_default;
+	OD_t *od = cfg->od ? cfg->od : OD;
+	co_od_lut_init(od); // kept for the process lifetime like the OD, without memory OD_find() searches the list
+#ifdef CO_MULTIPLE_OD
+	CO_config_t config;
+	if(cfg->config)
+		config = *cfg->config;
+	else
+		co_od_config(&config, od);
+	*co = CO_new(&config, NULL);
+	if(!(*co)) return 2;
+	(*co)->configOD = config; // the stack keeps using it after CO_new()
+	(*co)->config = &(*co)->configOD;
+#else
+	if(od != OD) return 2; // CO_new() takes the object counts from OD.h, build with CO_MULTIPLE_OD
 	*co = CO_new(NULL, NULL);
 	if(!(*co)) return 2;
+#endif
+	(*co)->od = od;
+	(*co)->pendingNodeId = cfg->node_id;
+	(*co)->pendingBitRate = cfg->baud;
 
-	(*co)->CANmodule->CANptr = sp;
+	int sts = 0;
+#if defined(_WIN32)
+	InitializeCriticalSection(&(*co)->CANmodule->tx.lock);
+	(*co)->CANmodule->thr_evt = CreateEvent(NULL, false, false, NULL);
+	if(!(*co)->CANmodule->thr_evt)
+	{
+		sts = 7;
+		goto FAIL;
+	}
+#else
+	pthread_mutex_init(&(*co)->CANmodule->tx.lock, NULL);
+	(*co)->CANmodule->thr_evt = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if((*co)->CANmodule->thr_evt < 0)
+	{
+		sts = 7;
+		goto FAIL;
+	}
+#endif
+
+	(*co)->CANmodule->CANptr = CANptr;
+	(*co)->CANmodule->co = *co;
+	(*co)->CANmodule->drv = drv;
 	(*co)->CANmodule->CANnormal = false;
 
 	CO_CANsetConfigurationMode((*co)->CANmodule->CANptr);
 	CO_CANmodule_disable((*co)->CANmodule);
-	if(CO_CANinit(*co, (*co)->CANmodule->CANptr, pending_can_baud) != CO_ERROR_NO) return 3;
+	if(CO_CANinit(*co, (*co)->CANmodule->CANptr, (*co)->pendingBitRate) != CO_ERROR_NO)
+	{
+		sts = 3;
+		goto FAIL;
+	}
+
+	if(od_setup(od, cfg) != CO_ERROR_NO || hb_cons_init(*co) != CO_ERROR_NO)
+	{
+		sts = 4;
+		goto FAIL;
+	}
 
-	OD_PERSIST_COMM.x1017_producerHeartbeatTime = 0;
-	for(uint32_t i = 0; i < 127; i++)
+#if(CO_CONFIG_LSS) & CO_CONFIG_LSS_SLAVE
+	CO_LSS_address_t lssAddress = {0};
+	OD_entry_t *id = OD_find(od, 0x1018);
+	OD_get_u32(id, 1, &lssAddress.identity.vendorID, true);
+	OD_get_u32(id, 2, &lssAddress.identity.productCode, true);
+	OD_get_u32(id, 3, &lssAddress.identity.revisionNumber, true);
+	OD_get_u32(id, 4, &lssAddress.identity.serialNumber, true);
+	if(CO_LSSinit(*co, &lssAddress, &(*co)->pendingNodeId, &(*co)->pendingBitRate) != CO_ERROR_NO)
 	{
-		OD_PERSIST_COMM.x1016_consumerHeartbeatTime[i] = ((i + 1) << 16) | 2500;
+		sts = 8;
+		goto FAIL;
 	}
+#endif
 
-	g_active_can_node_id = pending_can_node_id;
+	(*co)->activeNodeId = (*co)->pendingNodeId;
 	uint32_t errInfo = 0;
 	CO_ReturnError_t err = CO_CANopenInit(*co,		   /* CANopen object */
 										  NULL,		   /* alternate NMT */
 										  NULL,		   /* alternate em */
-										  OD,		   /* Object dictionary */
+										  od,		   /* Object dictionary */
 										  NULL,		   /* Optional OD_statusBits */
 										  NMT_CONTROL, /* CO_NMT_control_t */
 										  0,		   /* firstHBTime_ms */
 										  1000,		   /* SDOserverTimeoutTime_ms */
 										  500,		   /* SDOclientTimeoutTime_ms */
 										  false,	   /* SDOclientBlockTransfer */
-										  g_active_can_node_id,
+										  (*co)->activeNodeId,
 										  &errInfo);
 
-	if(err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS) return err;
+	if(err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS)
+	{
+		sts = err;
+		goto FAIL;
+	}
 
-	err = CO_CANopenInitPDO(*co, (*co)->em, OD, g_active_can_node_id, &errInfo);
-	if(err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS) return 5;
+	err = CO_CANopenInitPDO(*co, (*co)->em, od, (*co)->activeNodeId, &errInfo);
+	if(err != CO_ERROR_NO && err != CO_ERROR_NODE_ID_UNCONFIGURED_LSS)
+	{
+		sts = 5;
+		goto FAIL;
+	}
 
 #ifdef CO_CONFIG_TERM
 	(*co)->TIME->t = &(*co)->term;
-	co_term_init(&(*co)->term, (*co)->CANmodule, (*co)->TIME->CANtxBuff);
+	co_term_init(&(*co)->term, (*co)->CANmodule, (*co)->activeNodeId, (*co)->TIME->CANtxBuff);
 #endif
 
-	CO_CANsetNormalMode((*co)->CANmodule);
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+#ifdef CO_MULTIPLE_OD
+	co_sdo_async_init(&(*co)->sdo_async, (*co)->CANmodule, (*co)->SDOclient, (*co)->config->CNT_SDO_CLI, 500);
+#else
+	co_sdo_async_init(&(*co)->sdo_async, (*co)->CANmodule, (*co)->SDOclient, OD_CNT_SDO_CLI, 500);
+#endif
+#endif
 
-	(*co)->CANmodule->slcan.pos = 0;
+	CO_CANsetNormalMode((*co)->CANmodule);
 
 	(*co)->CANmodule->thr_run = true;
 #if defined(_WIN32)
 	(*co)->CANmodule->thr_rcv = (HANDLE)_beginthreadex(0, 0, &thr_poll, *co, 0, 0);
-	if(!(*co)->CANmodule->thr_rcv || (*co)->CANmodule->thr_rcv == INVALID_HANDLE_VALUE) return 6;
+	if(!(*co)->CANmodule->thr_rcv || (*co)->CANmodule->thr_rcv == INVALID_HANDLE_VALUE)
+	{
+		sts = 6;
+		goto FAIL;
+	}
 #else
-	if(pthread_create(&((*co)->CANmodule->thr_rcv), NULL, thr_rcv, *co)) return 6;
+	if(pthread_create(&((*co)->CANmodule->thr_rcv), NULL, thr_rcv, *co))
+	{
+		sts = 6;
+		goto FAIL;
+	}
 #endif
 
 	return 0;
+
+FAIL:
+	co_wrapper_free(*co);
+	*co = NULL;
+	return sts;
 }
 
+int co_wrapper_init(CO_t **co, sp_t *sp, const co_wrapper_cfg_t *cfg) { return co_wrapper_init_drv(co, sp, &CO_CANdrv_slcan, cfg); }
+
+#if defined(__linux__)
+int co_wrapper_init_socketcan(CO_t **co, socketcan_t *can, const co_wrapper_cfg_t *cfg) { return co_wrapper_init_drv(co, can, &CO_CANdrv_socketcan, cfg); }
+#endif
+
 void co_wrapper_deinit(CO_t **co)
 {
 	if(*co)
@@ -129,14 +309,15 @@ void co_wrapper_deinit(CO_t **co)
 #if defined(_WIN32)
 		if(WaitForSingleObject((*co)->CANmodule->thr_rcv, 0) == WAIT_OBJECT_0) printf("[CO] thread exited!\n");
 		(*co)->CANmodule->thr_run = false;
+		CO_CANmodule_wakeup((*co)->CANmodule);
 		if((*co)->CANmodule->thr_rcv) WaitForSingleObject((*co)->CANmodule->thr_rcv, INFINITE);
-
 #else
 		if((*co)->CANmodule->thr_exited) printf("[CO] thread exited!\n");
 		(*co)->CANmodule->thr_run = false;
+		CO_CANmodule_wakeup((*co)->CANmodule);
 		pthread_join((*co)->CANmodule->thr_rcv, NULL);
 #endif
-		CO_delete(*co);
+		co_wrapper_free(*co);
 		*co = NULL;
 	}
 }
@@ -3,9 +3,30 @@
 
 #include <CANopen.h>
 #include <OD.h>
+#include <socketcan.h>
 #include <sp.h>
 
-int co_wrapper_init(CO_t **co, sp_t *sp);
+// Settings of one CANopen instance, NULL for the defaults (node 2, 500 kbit/s, no heartbeat, consumer 2500 ms)
+typedef struct
+{
+	uint8_t node_id;	 // 0xFF leaves it to an LSS master (LSS slave builds)
+	uint16_t baud;		 // kbit/s
+	uint16_t hb_ms;		 // 0x1017 producer heartbeat, 0 - off
+	uint16_t hb_cons_ms; // 0x1016 consumer time for nodes 1..n, 0 - off
+	OD_t *od;			 // NULL - the global OD; a private one (co_od_clone()) needs CO_MULTIPLE_OD
+#ifdef CO_MULTIPLE_OD
+	CO_config_t *config; // NULL - co_od_config() of od
+#endif
+} co_wrapper_cfg_t;
+
+// Open the port after init: sp_open(sp, ..., co), socketcan_open(can, ..., co->CANmodule)
+int co_wrapper_init(CO_t **co, sp_t *sp, const co_wrapper_cfg_t *cfg);
+#if defined(__linux__)
+int co_wrapper_init_socketcan(CO_t **co, socketcan_t *can, const co_wrapper_cfg_t *cfg);
+#endif
 void co_wrapper_deinit(CO_t **co);
 
+// 0x1016 consumer time of heartbeat consumer idx (sub idx + 1) in the instance's OD, false if the sub is missing
+bool co_wrapper_hb_cons_ms(CO_t *co, uint8_t idx, uint16_t *ms);
+
 #endif // CO_WRAPPER_H_
\ No newline at end of file
@@ -0,0 +1,306 @@
+#include "lss_commission.h"
+#include <string.h>
+#include <sys/time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#if(CO_CONFIG_LSS) & CO_CONFIG_LSS_MASTER
+
+#define CM_TIMEOUT_MIN_US 1000
+#define CM_TIMEOUT_MAX_US 100000
+#define CM_TIMEOUT_MARGIN_US 500 // on top of 2 x slowest answer: late duplicates of an answer must land in its own window
+#define CM_POLL_US 100
+#define CM_SCAN_RETRY 2 // failed full fastscans, each with the timeout doubled
+
+typedef struct
+{
+	lss_cm_t *cm;
+	CO_LSSmaster_t *m;
+	bool_t adaptive;  // fastscan: timeout from the measured answers, else the default for confirmed services
+	uint32_t dt;	  // timeDifference_us for the next call
+	uint64_t t_prev;  // last call
+	uint8_t tx[8];	  // last request seen in the tx buffer
+	uint32_t req;	  // requests of the running service, 0 - the service didn't start yet
+	bool_t tx_seen;	  // tx holds a request of the running service
+	bool_t answered;  // the request in tx got an answer
+	bool_t first_answered; // fastscan: some unconfigured slave answered the initial confirm request
+	bool_t id_ok;		  // configure: the slave took the node-ID, it won't answer a fastscan any more
+	uint64_t t_tx;	  // the request in tx was sent
+	volatile uint64_t t_rx; // last answer, stamped in the CANopen thread
+} cm_ctx_t;
+
+static uint64_t now_us(void)
+{
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (uint64_t)tv.tv_sec * 1000000 + (uint64_t)tv.tv_usec;
+}
+
+static void sleep_us(uint32_t us)
+{
+#ifdef _WIN32
+	Sleep((us + 999) / 1000);
+#else
+	struct timespec ts = {.tv_sec = 0, .tv_nsec = (long)us * 1000};
+	nanosleep(&ts, NULL);
+#endif
+}
+
+#if(CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE
+static void on_answer(void *object) { ((cm_ctx_t *)object)->t_rx = now_us(); }
+#endif
+
+// The tx buffer is shared by all requests: a frame still queued would go out with the next request's data
+static void tx_drain(cm_ctx_t *x)
+{
+	for(uint32_t i = 0; x->m->TXbuff->bufferFull && i < CM_TIMEOUT_MAX_US / CM_POLL_US; i++) sleep_us(CM_POLL_US);
+}
+
+static void timeout_update(lss_cm_t *cm)
+{
+	uint64_t t = 2ull * cm->rtt_max_us + CM_TIMEOUT_MARGIN_US;
+	if(t < cm->timeout_min_us) t = cm->timeout_min_us;
+	if(t > cm->timeout_max_us) t = cm->timeout_max_us;
+	cm->timeout_us = (uint32_t)t;
+}
+
+// Request in tx is over: answered or timed out
+static void request_done(cm_ctx_t *x)
+{
+	if(!x->tx_seen) return;
+	lss_cm_t *cm = x->cm;
+	if(!x->answered) cm->no_answer++;
+	x->tx_seen = false;
+}
+
+static void answer_check(cm_ctx_t *x)
+{
+	if(!x->tx_seen || x->answered) return;
+#if !((CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE)
+	if(CO_FLAG_READ(x->m->CANrxNew)) x->t_rx = now_us(); // poll resolution only
+#endif
+	if(x->t_rx < x->t_tx) return;
+	lss_cm_t *cm = x->cm;
+	x->answered = true;
+	if(x->req == 1) x->first_answered = true;
+	const uint32_t rtt = (uint32_t)(x->t_rx - x->t_tx);
+	if(!cm->rtt_min_us || rtt < cm->rtt_min_us) cm->rtt_min_us = rtt;
+	if(x->adaptive && rtt > cm->rtt_max_us)
+	{
+		cm->rtt_max_us = rtt;
+		timeout_update(cm); // from the next bit on
+	}
+}
+
+static uint64_t cm_before(cm_ctx_t *x)
+{
+	tx_drain(x);
+	x->m->timeout_us = x->adaptive ? x->cm->timeout_us : CO_LSSmaster_DEFAULT_TIMEOUT * 1000;
+	const uint64_t t = now_us();
+	x->dt = x->t_prev && t > x->t_prev ? (uint32_t)(t - x->t_prev) : 1; // never 0: the master's timer must move
+	x->t_prev = t;
+	return t;
+}
+
+// After each call: the first call of a service sends its request, later a changed tx buffer is the next one
+// (consecutive fastscan requests always differ in bit, sub or next). True while the service waits for the slave
+static bool_t cm_after(cm_ctx_t *x, uint64_t t_call, CO_LSSmaster_return_t ret)
+{
+	if(!x->req || memcmp(x->tx, x->m->TXbuff->data, sizeof(x->tx)))
+	{
+		request_done(x);
+		memcpy(x->tx, x->m->TXbuff->data, sizeof(x->tx));
+		x->req++;
+		x->tx_seen = true;
+		x->answered = false;
+		x->t_tx = t_call;
+		x->cm->round_trips++;
+	}
+	answer_check(x);
+	if(ret == CO_LSSmaster_WAIT_SLAVE)
+	{
+		sleep_us(CM_POLL_US);
+		return true;
+	}
+	request_done(x);
+	return false;
+}
+
+#define CM_SERVICE(x, f)                           \
+	do                                             \
+	{                                              \
+		(x)->req = 0;                              \
+		(x)->t_prev = 0;                           \
+		while(1)                                   \
+		{                                          \
+			const uint64_t t_call = cm_before(x); \
+			f;                                     \
+			if(!cm_after(x, t_call, ret)) break;   \
+		}                                          \
+	} while(0)
+
+static CO_LSSmaster_return_t cm_fastscan(cm_ctx_t *x, CO_LSSmaster_fastscan_t *fs)
+{
+	CO_LSSmaster_return_t ret;
+	x->adaptive = true;
+	x->first_answered = false;
+	CM_SERVICE(x, ret = CO_LSSmaster_IdentifyFastscan(x->m, x->dt, fs));
+	return ret;
+}
+
+static void cm_unconfirmed(cm_ctx_t *x)
+{
+	x->cm->unconfirmed++;
+	tx_drain(x);
+}
+
+// Slave is selected: node-ID, bit timing, store, then back to waiting
+static CO_LSSmaster_return_t cm_configure(cm_ctx_t *x, const CO_LSS_address_t *addr, uint8_t node_id)
+{
+	lss_cm_t *cm = x->cm;
+	CO_LSSmaster_return_t ret;
+	x->adaptive = false;
+	CM_SERVICE(x, ret = CO_LSSmaster_configureNodeId(x->m, x->dt, node_id));
+	x->id_ok = ret == CO_LSSmaster_OK;
+	if(ret == CO_LSSmaster_OK && cm->kbit_s) CM_SERVICE(x, ret = CO_LSSmaster_configureBitTiming(x->m, x->dt, cm->kbit_s));
+	if(ret == CO_LSSmaster_OK && cm->store) CM_SERVICE(x, ret = CO_LSSmaster_configureStore(x->m, x->dt));
+	tx_drain(x);
+	CO_LSSmaster_switchStateDeselect(x->m);
+	cm_unconfirmed(x);
+	if(ret == CO_LSSmaster_OK) cm->configured++;
+	if(cm->on_node) cm->on_node(cm->priv, addr, node_id, ret);
+	return ret;
+}
+
+static bool_t addr_match(const CO_LSS_address_t *a, const CO_LSS_address_t *b)
+{
+	return a->identity.vendorID == b->identity.vendorID && a->identity.productCode == b->identity.productCode && a->identity.serialNumber == b->identity.serialNumber;
+}
+
+static bool_t id_used(const lss_cm_node_t *nodes, size_t cnt, const uint8_t *pool_used, uint8_t id)
+{
+	for(size_t i = 0; i < cnt; i++)
+		if(nodes[i].node_id == id) return true;
+	return pool_used[id] != 0;
+}
+
+// 1. manifest entries one by one: vendor, product, serial matched, revision skipped
+static int cm_targeted(cm_ctx_t *x, lss_cm_node_t *nodes, size_t cnt)
+{
+	for(size_t i = 0; i < cnt; i++)
+	{
+		lss_cm_node_t *n = &nodes[i];
+		if(n->state != LSS_CM_PENDING) continue;
+		CO_LSSmaster_fastscan_t fs = {.scan = {CO_LSSmaster_FS_MATCH, CO_LSSmaster_FS_MATCH, CO_LSSmaster_FS_SKIP, CO_LSSmaster_FS_MATCH}, .match = n->addr};
+		const CO_LSSmaster_return_t ret = cm_fastscan(x, &fs);
+		if(ret == CO_LSSmaster_SCAN_FINISHED)
+			n->state = cm_configure(x, &n->addr, n->node_id) == CO_LSSmaster_OK ? LSS_CM_ASSIGNED : LSS_CM_FAILED;
+		else if(ret == CO_LSSmaster_SCAN_NOACK && !x->first_answered) // no unconfigured slave left at all
+			break;
+		else if(ret != CO_LSSmaster_SCAN_NOACK)
+			return ret;
+	}
+	return 0;
+}
+
+// 2. full fastscans until no unconfigured slave answers
+static int cm_discover(cm_ctx_t *x, lss_cm_node_t *nodes, size_t cnt)
+{
+	lss_cm_t *cm = x->cm;
+	uint8_t pool_used[128] = {0};
+	uint8_t pool_next = cm->pool_first;
+	uint32_t retry = 0;
+	while(1)
+	{
+		CO_LSSmaster_fastscan_t fs = {.scan = {CO_LSSmaster_FS_SCAN, CO_LSSmaster_FS_SCAN, CO_LSSmaster_FS_SCAN, CO_LSSmaster_FS_SCAN}};
+		const CO_LSSmaster_return_t ret = cm_fastscan(x, &fs);
+		if(ret == CO_LSSmaster_SCAN_NOACK && !x->first_answered) return 0; // nobody left
+		if(ret != CO_LSSmaster_SCAN_FINISHED)
+		{
+			// a bit decided by a too short timeout: the address doesn't verify
+			if(++retry > CM_SCAN_RETRY) return ret;
+			if(cm->timeout_min_us < cm->timeout_max_us / 2) cm->timeout_min_us *= 2;
+			timeout_update(cm);
+			continue;
+		}
+
+		lss_cm_node_t *n = NULL;
+		for(size_t i = 0; i < cnt && !n; i++)
+			if(nodes[i].state != LSS_CM_ASSIGNED && addr_match(&nodes[i].addr, &fs.found)) n = &nodes[i];
+		if(n)
+		{
+			const CO_LSSmaster_return_t ret_cfg = cm_configure(x, &fs.found, n->node_id);
+			n->state = ret_cfg == CO_LSSmaster_OK ? LSS_CM_ASSIGNED : LSS_CM_FAILED;
+			if(!x->id_ok) return ret_cfg; // still unconfigured, it would win the next scan again
+			continue;
+		}
+
+		while(pool_next && pool_next <= cm->pool_last && id_used(nodes, cnt, pool_used, pool_next)) pool_next++;
+		if(!pool_next || pool_next > cm->pool_last)
+		{
+			// left unconfigured it wins every following scan: stop here
+			CO_LSSmaster_switchStateDeselect(x->m);
+			cm_unconfirmed(x);
+			cm->unknown++;
+			if(cm->on_node) cm->on_node(cm->priv, &fs.found, 0, CO_LSSmaster_OK);
+			return 0;
+		}
+		pool_used[pool_next] = 1;
+		const CO_LSSmaster_return_t ret_cfg = cm_configure(x, &fs.found, pool_next);
+		if(!x->id_ok) return ret_cfg;
+	}
+}
+
+int lss_cm_run(CO_t *co, lss_cm_t *cm, lss_cm_node_t *nodes, size_t cnt)
+{
+	cm_ctx_t x = {.cm = cm, .m = co->LSSmaster};
+	const uint64_t t0 = now_us();
+	if(!cm->timeout_min_us) cm->timeout_min_us = CM_TIMEOUT_MIN_US;
+	if(!cm->timeout_max_us) cm->timeout_max_us = CM_TIMEOUT_MAX_US;
+	if(cm->timeout_min_us > cm->timeout_max_us) cm->timeout_min_us = cm->timeout_max_us;
+	cm->timeout_us = cm->timeout_max_us; // until the first answer is measured
+	if(cm->pool_last > 127) cm->pool_last = 127; // pool_used[] is indexed by node-ID
+#if(CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE
+	CO_LSSmaster_initCallbackPre(x.m, &x, on_answer);
+#endif
+
+	// a slave left selected by someone else would answer the configuration services
+	CO_LSSmaster_switchStateDeselect(x.m);
+	cm_unconfirmed(&x);
+
+	int ret = cm_targeted(&x, nodes, cnt);
+	if(!ret) ret = cm_discover(&x, nodes, cnt);
+	for(size_t i = 0; i < cnt; i++)
+		if(nodes[i].state == LSS_CM_PENDING) nodes[i].state = LSS_CM_ABSENT;
+
+	// 3. one global sequence for everything configured above
+	if(cm->configured && cm->kbit_s)
+	{
+		CO_LSSmaster_switchStateSelect(x.m, 0, NULL); // global configuration state, unconfirmed
+		cm_unconfirmed(&x);
+		CO_LSSmaster_ActivateBit(x.m, cm->switch_delay_ms);
+		cm_unconfirmed(&x);
+		CO_LSSmaster_switchStateDeselect(x.m);
+		cm_unconfirmed(&x);
+	}
+#if(CO_CONFIG_NMT) & CO_CONFIG_NMT_MASTER
+	if(cm->configured && cm->reset)
+	{
+		CO_NMT_sendCommand(co->NMT, CO_NMT_RESET_COMMUNICATION, 0);
+		cm->unconfirmed++;
+	}
+#endif
+
+#if(CO_CONFIG_LSS) & CO_CONFIG_FLAG_CALLBACK_PRE
+	CO_LSSmaster_initCallbackPre(x.m, NULL, NULL);
+#endif
+	CO_LSSmaster_changeTimeout(x.m, CO_LSSmaster_DEFAULT_TIMEOUT);
+	cm->elapsed_us = now_us() - t0;
+	return ret;
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef LSS_COMMISSION_H_
+#define LSS_COMMISSION_H_
+
+#include "305/CO_LSS.h"
+#include "305/CO_LSSmaster.h"
+#include "CANopen.h"
+#include <stdint.h>
+
+/**
+ * Commissioning of unconfigured LSS slaves from a manifest (vendor/product/serial -> node-ID):
+ * 	1. every manifest entry is selected with a fastscan that matches vendor, product and serial and skips the
+ * 	   revision: 4 round trips instead of 1 + 33 per scanned 32 bit part
+ * 	2. repeated full fastscans pick up the rest: manifest entries missed in 1., others get node-IDs from the pool
+ * 	3. one global activation of the bit timing, optionally an NMT reset communication so the node-IDs take effect
+ * Node-ID, bit timing and the store (a selective service) are configured while a slave is selected.
+ * A fastscan step without an answer costs the full response timeout: it is derived from the measured response
+ * times (2 x slowest + margin, within timeout_min_us..timeout_max_us) and updated after every answered bit.
+ */
+
+typedef enum
+{
+	LSS_CM_PENDING,
+	LSS_CM_ASSIGNED, // node-ID configured (pending in the slave until reset communication)
+	LSS_CM_ABSENT,	 // no unconfigured slave with this address
+	LSS_CM_FAILED,	 // selected, but configuration or store was refused
+} lss_cm_state_t;
+
+typedef struct
+{
+	CO_LSS_address_t addr; // vendor, product, serial; revisionNumber not used
+	uint8_t node_id;
+	lss_cm_state_t state;
+} lss_cm_node_t;
+
+typedef struct
+{
+	// settings
+	uint16_t kbit_s;						 // bit timing for the configured slaves, 0 - keep
+	uint16_t switch_delay_ms;				 // bit timing activation delay
+	bool_t store;							 // store node-ID/bit timing in the slave
+	bool_t reset;							 // NMT reset communication of all nodes at the end (NMT master builds)
+	uint8_t pool_first, pool_last;			 // node-IDs for slaves outside the manifest, 0 - leave them unconfigured
+	uint32_t timeout_min_us, timeout_max_us; // adaptive fastscan timeout bounds, 0 - defaults
+	void (*on_node)(void *priv, const CO_LSS_address_t *addr, uint8_t node_id, int ret); // each selected slave, optional
+	void *priv;
+
+	// results
+	uint32_t round_trips; // LSS requests that wait for an answer
+	uint32_t no_answer;	  // of them ended by the timeout
+	uint32_t unconfirmed; // frames without an answer (deselect, activation, NMT)
+	uint32_t rtt_min_us, rtt_max_us;
+	uint32_t timeout_us; // fastscan timeout at the end
+	uint32_t configured; // slaves given a node-ID
+	uint32_t unknown;	 // unconfigured slaves outside the manifest left without node-ID
+	uint64_t elapsed_us;
+} lss_cm_t;
+
+/**
+ * @brief Commissions the slaves of the manifest, see above. Blocks until done
+ *
+ * @param nodes manifest, state is updated
+ * @return int 0 or ::CO_LSSmaster_return_t of the step that stopped the run
+ */
+int lss_cm_run(CO_t *co, lss_cm_t *cm, lss_cm_node_t *nodes, size_t cnt);
+
+#endif // LSS_COMMISSION_H_
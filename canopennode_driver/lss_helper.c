@@ -1,21 +1,6 @@
 #include "lss_helper.h"
 #include "CANopen.h"
-
-#ifdef _WIN32
-#include <windows.h>
-#define SLEEP_MS(msecs) Sleep(msecs)
-#else
-#include <errno.h>
-#include <time.h>
-#define SLEEP_MS(msecs)                                                            \
-	struct timespec ts = {.tv_sec = msecs / 1000, .tv_nsec = msecs % 1000 * 1000}; \
-	int res;                                                                       \
-	do                                                                             \
-	{                                                                              \
-		errno = 0;                                                                 \
-		res = nanosleep(&ts, NULL);                                                \
-	} while(res != 0 && errno == EINTR)
-#endif
+#include "../timedate.h"
 
 #define LSS_POLLING_FUNC(f) \
 	do                      \
@@ -1,36 +1,194 @@
 #include "sdo.h"
 #include "co_wrapper.h"
+#include "../timedate.h"
 #include <errno.h>
+#include <string.h>
 #include <sys/time.h>
 
-#define TIME_DELTA_US(x, y) ((x.tv_sec - y.tv_sec) * 1000000LL + (x.tv_usec - y.tv_usec))
+#define SDO_WAIT_MAX_US 100000 // upper bound when the client doesn't report timerNext_us
+#define SDO_TX_WAIT_MAX_US 1000 // CANtxBuff still queued (block download): the CANopen thread's flush wakes the caller
 
-#ifndef CO_SDO_HI_SPEED_MODE
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_FLAG_CALLBACK_PRE
+/* Response frames wake the caller: the pre-callback runs in the CANopen thread from CO_SDOclient_receive(), so does
+ * CANmodule->tx.flushed once the queued CANtxBuff went out. One event is shared by all clients, waiters recheck their
+ * client after a wakeup. */
 #ifdef _WIN32
 #include <windows.h>
-#define SLEEP_MS(msecs) Sleep(msecs)
+static struct
+{
+	SRWLOCK lock;
+	CONDITION_VARIABLE cond;
+	volatile uint32_t seq;
+	uint32_t waiters; // the signal skips lock and wakeup while nobody sleeps (every tx flush signals)
+} sdo_evt = {SRWLOCK_INIT, CONDITION_VARIABLE_INIT, 0, 0};
 #else
-#include <errno.h>
+#include <pthread.h>
 #include <time.h>
-#define SLEEP_MS(msecs)                                                            \
-	struct timespec ts = {.tv_sec = msecs / 1000, .tv_nsec = msecs % 1000 * 1000}; \
-	int res;                                                                       \
-	do                                                                             \
-	{                                                                              \
-		errno = 0;                                                                 \
-		res = nanosleep(&ts, NULL);                                                \
-	} while(res != 0 && errno == EINTR)
+static struct
+{
+	pthread_mutex_t lock;
+	pthread_cond_t cond; // CLOCK_MONOTONIC, set up by the first sdo_wait()
+	volatile uint32_t seq;
+	uint32_t waiters; // the signal skips lock and wakeup while nobody sleeps (every tx flush signals)
+} sdo_evt = {.lock = PTHREAD_MUTEX_INITIALIZER};
+static pthread_once_t sdo_evt_once = PTHREAD_ONCE_INIT;
+
+// A wall clock step must not stretch the timeout, the default condvar clock is CLOCK_REALTIME
+static void sdo_evt_init(void)
+{
+	pthread_condattr_t attr;
+	pthread_condattr_init(&attr);
+	pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+	pthread_cond_init(&sdo_evt.cond, &attr);
+	pthread_condattr_destroy(&attr);
+}
 #endif
+
+// seq and waiters are both seq_cst: either the waiter sees the new seq or the signal sees the waiter (so cond is set up)
+static void sdo_signal(void *object)
+{
+	(void)object;
+	__atomic_add_fetch(&sdo_evt.seq, 1, __ATOMIC_SEQ_CST);
+	if(!__atomic_load_n(&sdo_evt.waiters, __ATOMIC_SEQ_CST)) return;
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&sdo_evt.lock);
+	ReleaseSRWLockExclusive(&sdo_evt.lock);
+	WakeAllConditionVariable(&sdo_evt.cond);
+#else
+	pthread_mutex_lock(&sdo_evt.lock);
+	pthread_cond_broadcast(&sdo_evt.cond);
+	pthread_mutex_unlock(&sdo_evt.lock);
 #endif
+}
 
-CO_SDO_abortCode_t read_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, uint8_t *buf, size_t bufSize, size_t *readSize, uint32_t timeout_ms)
+// Sleep until a response frame arrived (or the tx queue was flushed) after 'seq' was sampled or timeout_us expires
+static void sdo_wait(uint32_t seq, uint32_t timeout_us)
 {
-	*readSize = 0;
-	CO_SDO_return_t SDO_ret = CO_SDOclient_setup(SDO_C, CO_CAN_ID_SDO_CLI + nodeId, CO_CAN_ID_SDO_SRV + nodeId, nodeId);
-	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+	if(timeout_us == 0) return;
+#ifdef _WIN32
+	AcquireSRWLockExclusive(&sdo_evt.lock);
+	__atomic_add_fetch(&sdo_evt.waiters, 1, __ATOMIC_SEQ_CST);
+	if(__atomic_load_n(&sdo_evt.seq, __ATOMIC_SEQ_CST) == seq) SleepConditionVariableSRW(&sdo_evt.cond, &sdo_evt.lock, (timeout_us + 999) / 1000, 0);
+	__atomic_sub_fetch(&sdo_evt.waiters, 1, __ATOMIC_SEQ_CST);
+	ReleaseSRWLockExclusive(&sdo_evt.lock);
+#else
+	pthread_once(&sdo_evt_once, sdo_evt_init);
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ts.tv_sec += timeout_us / 1000000;
+	ts.tv_nsec += (long)(timeout_us % 1000000) * 1000;
+	if(ts.tv_nsec >= 1000000000L)
+	{
+		ts.tv_sec++;
+		ts.tv_nsec -= 1000000000L;
+	}
+	pthread_mutex_lock(&sdo_evt.lock);
+	__atomic_add_fetch(&sdo_evt.waiters, 1, __ATOMIC_SEQ_CST);
+	while(__atomic_load_n(&sdo_evt.seq, __ATOMIC_SEQ_CST) == seq)
+	{
+		if(pthread_cond_timedwait(&sdo_evt.cond, &sdo_evt.lock, &ts) == ETIMEDOUT) break;
+	}
+	__atomic_sub_fetch(&sdo_evt.waiters, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_unlock(&sdo_evt.lock);
+#endif
+}
+
+#define SDO_WAIT_INIT(SDO_C)                                  \
+	{                                                         \
+		CO_SDOclient_initCallbackPre(SDO_C, NULL, sdo_signal); \
+		(SDO_C)->CANdevTx->tx.flushed = sdo_signal;            \
+	}
+#define SDO_WAIT_SEQ() __atomic_load_n(&sdo_evt.seq, __ATOMIC_ACQUIRE)
+#define SDO_WAIT(seq, timeout_us) sdo_wait(seq, timeout_us)
+
+#elif defined(CO_SDO_HI_SPEED_MODE)
+#define SDO_WAIT_INIT(SDO_C)
+#define SDO_WAIT_SEQ() 0
+#define SDO_WAIT(seq, timeout_us) (void)(seq)
+
+#else
+#define SDO_WAIT_INIT(SDO_C)
+#define SDO_WAIT_SEQ() 0
+#define SDO_WAIT(seq, timeout_us) \
+	do                            \
+	{                             \
+		(void)(seq);              \
+		SLEEP_MS(1);              \
+	} while(0)
+#endif
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+// Nodes refusing block transfers and the object sizes seen, per bus: its co_sdo_async_t
+static CO_sdo_async_t *bus(CO_SDOclient_t *SDO_C)
+{
+	static CO_sdo_async_t no_wrapper; // module not set up by co_wrapper
+	CO_t *co = SDO_C->CANdevTx->co;
+	return co ? &co->sdo_async : &no_wrapper;
+}
+#define SDO_USE_BLOCK(SDO_C, nodeId, index, subIndex, write, size, sink) co_sdo_block(bus(SDO_C), nodeId, index, subIndex, write, size, sink)
+#define SDO_SIZE_SEEN(SDO_C, nodeId, index, subIndex, size) co_sdo_size_seen(bus(SDO_C), nodeId, index, subIndex, size)
+#else
+#define SDO_USE_BLOCK(SDO_C, nodeId, index, subIndex, write, size, sink) false
+#define SDO_SIZE_SEEN(SDO_C, nodeId, index, subIndex, size) (void)(size)
+#endif
+
+// read_SDO()/write_SDO() buffers as a sink/source
+typedef struct
+{
+	uint8_t *buf;
+	size_t size;
+} sdo_mem_t;
+
+// Takes everything so the transfer completes, bytes past the buffer are dropped (read_SDO() truncates)
+static size_t mem_sink(void *priv, size_t offset, const uint8_t *data, size_t len)
+{
+	sdo_mem_t *m = priv;
+	if(offset < m->size) memcpy(m->buf + offset, data, len < m->size - offset ? len : m->size - offset);
+	return len;
+}
+
+static size_t mem_source(void *priv, size_t offset, uint8_t *buf, size_t len)
+{
+	sdo_mem_t *m = priv;
+	memcpy(buf, m->buf + offset, len);
+	return len;
+}
+
+// Passes the client fifo to the sink, false when the sink doesn't take everything
+static bool_t upload_drain(CO_SDOclient_t *SDO_C, co_sdo_sink_t sink, void *priv, size_t *readSize)
+{
+	uint8_t chunk[256];
+	size_t n;
+	while((n = CO_SDOclientUploadBufRead(SDO_C, chunk, sizeof(chunk))) > 0)
+	{
+		if(sink(priv, *readSize, chunk, n) != n) return false;
+		*readSize += n;
+	}
+	return true;
+}
 
-	SDO_ret = CO_SDOclientUploadInitiate(SDO_C, index, subIndex, timeout_ms, false);
+// Tops the client fifo up from the source, false when the source fails
+static bool_t download_fill(CO_SDOclient_t *SDO_C, co_sdo_source_t source, void *priv, size_t dataSize, size_t *nWritten)
+{
+	uint8_t chunk[256];
+	size_t space;
+	while(*nWritten < dataSize && (space = CO_fifo_getSpace(&SDO_C->bufFifo)) > 0)
+	{
+		size_t n = dataSize - *nWritten;
+		if(n > space) n = space;
+		if(n > sizeof(chunk)) n = sizeof(chunk);
+		if(source(priv, *nWritten, chunk, n) != n) return false;
+		*nWritten += CO_SDOclientDownloadBufWrite(SDO_C, chunk, n);
+	}
+	return true;
+}
+
+static CO_SDO_abortCode_t upload(CO_SDOclient_t *SDO_C, uint16_t index, uint8_t subIndex, co_sdo_sink_t sink, void *priv, size_t *readSize, uint32_t timeout_ms, bool_t block)
+{
+	*readSize = 0;
+	CO_SDO_return_t SDO_ret = CO_SDOclientUploadInitiate(SDO_C, index, subIndex, timeout_ms, block);
 	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+	SDO_WAIT_INIT(SDO_C);
 
 	struct timeval tprev, tnow;
 	gettimeofday(&tnow, NULL);
@@ -39,30 +197,37 @@ CO_SDO_abortCode_t read_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t inde
 		tprev = tnow;
 		gettimeofday(&tnow, NULL);
 		CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
-		SDO_ret = CO_SDOclientUpload(SDO_C, TIME_DELTA_US(tnow, tprev), false, &abortCode, NULL, NULL, NULL);
+		uint32_t timer_next_us = SDO_WAIT_MAX_US;
+		const uint32_t seq = SDO_WAIT_SEQ();
+		SDO_ret = CO_SDOclientUpload(SDO_C, TIME_DELTA_US(tnow, tprev), false, &abortCode, NULL, NULL, &timer_next_us);
 		if(SDO_ret < 0) return abortCode;
-#ifndef CO_SDO_HI_SPEED_MODE
-		SLEEP_MS(1);
-#endif
+		if(SDO_ret == CO_SDO_RT_uploadDataBufferFull || SDO_ret == CO_SDO_RT_ok_communicationEnd)
+		{
+			if(!upload_drain(SDO_C, sink, priv, readSize))
+			{
+				abortCode = CO_SDO_AB_OUT_OF_MEM;
+				if(SDO_ret != CO_SDO_RT_ok_communicationEnd) CO_SDOclientUpload(SDO_C, 0, true, &abortCode, NULL, NULL, NULL);
+				return abortCode;
+			}
+		}
+		else if(SDO_ret == CO_SDO_RT_transmittBufferFull)
+			SDO_WAIT(seq, SDO_TX_WAIT_MAX_US);
+		else if(SDO_ret > 0)
+			SDO_WAIT(seq, timer_next_us);
 	} while(SDO_ret > 0);
 
-	*readSize = CO_SDOclientUploadBufRead(SDO_C, buf, bufSize);
-
 	return CO_SDO_AB_NONE;
 }
 
-CO_SDO_abortCode_t write_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, uint8_t *data, size_t dataSize, uint32_t timeout_ms)
+static CO_SDO_abortCode_t download(CO_SDOclient_t *SDO_C, uint16_t index, uint8_t subIndex, co_sdo_source_t source, void *priv, size_t dataSize, uint32_t timeout_ms, bool_t block)
 {
-	bool_t bufferPartial = false;
-
-	CO_SDO_return_t SDO_ret = CO_SDOclient_setup(SDO_C, CO_CAN_ID_SDO_CLI + nodeId, CO_CAN_ID_SDO_SRV + nodeId, nodeId);
+	CO_SDO_return_t SDO_ret = CO_SDOclientDownloadInitiate(SDO_C, index, subIndex, dataSize, timeout_ms, block);
 	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
 
-	SDO_ret = CO_SDOclientDownloadInitiate(SDO_C, index, subIndex, dataSize, timeout_ms, false);
-	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+	SDO_WAIT_INIT(SDO_C);
 
-	size_t nWritten = CO_SDOclientDownloadBufWrite(SDO_C, data, dataSize);
-	if(nWritten < dataSize) bufferPartial = true;
+	size_t nWritten = 0;
+	bool_t abort = !download_fill(SDO_C, source, priv, dataSize, &nWritten);
 
 	struct timeval tprev, tnow;
 	gettimeofday(&tnow, NULL);
@@ -70,13 +235,75 @@ CO_SDO_abortCode_t write_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t ind
 	{
 		tprev = tnow;
 		gettimeofday(&tnow, NULL);
-		CO_SDO_abortCode_t abortCode = CO_SDO_AB_NONE;
-		SDO_ret = CO_SDOclientDownload(SDO_C, TIME_DELTA_US(tnow, tprev), false, bufferPartial, &abortCode, NULL, NULL);
+		CO_SDO_abortCode_t abortCode = abort ? CO_SDO_AB_DATA_LOC_CTRL : CO_SDO_AB_NONE;
+		uint32_t timer_next_us = SDO_WAIT_MAX_US;
+		const uint32_t seq = SDO_WAIT_SEQ();
+		if(!abort && nWritten < dataSize) abort = !download_fill(SDO_C, source, priv, dataSize, &nWritten);
+		if(abort) abortCode = CO_SDO_AB_DATA_LOC_CTRL;
+		SDO_ret = CO_SDOclientDownload(SDO_C, TIME_DELTA_US(tnow, tprev), abort, nWritten < dataSize, &abortCode, NULL, &timer_next_us);
 		if(SDO_ret < 0) return abortCode;
-#ifndef CO_SDO_HI_SPEED_MODE
-		SLEEP_MS(1);
-#endif
+		if(SDO_ret == CO_SDO_RT_transmittBufferFull)
+			SDO_WAIT(seq, SDO_TX_WAIT_MAX_US);
+		else if(SDO_ret > 0)
+			SDO_WAIT(seq, timer_next_us);
 	} while(SDO_ret > 0);
 
 	return CO_SDO_AB_NONE;
-}
\ No newline at end of file
+}
+
+// stream: a sink of unknown size, block mode unless the object was small last time
+static CO_SDO_abortCode_t read_stream(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, co_sdo_sink_t sink, void *priv, size_t *readSize, uint32_t timeout_ms, bool_t stream)
+{
+	*readSize = 0;
+	CO_SDO_return_t SDO_ret = CO_SDOclient_setup(SDO_C, CO_CAN_ID_SDO_CLI + nodeId, CO_CAN_ID_SDO_SRV + nodeId, nodeId);
+	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+
+	const bool_t block = SDO_USE_BLOCK(SDO_C, nodeId & 0x7F, index, subIndex, false, 0, stream);
+	CO_SDO_abortCode_t ret = upload(SDO_C, index, subIndex, sink, priv, readSize, timeout_ms, block);
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	if(block && CO_SDO_BLOCK_REFUSED(ret))
+	{
+		bus(SDO_C)->blk_refused[nodeId & 0x7F] = true;
+		ret = upload(SDO_C, index, subIndex, sink, priv, readSize, timeout_ms, false);
+	}
+#endif
+	if(!ret) SDO_SIZE_SEEN(SDO_C, nodeId & 0x7F, index, subIndex, *readSize);
+	return ret;
+}
+
+CO_SDO_abortCode_t read_SDO_stream(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, co_sdo_sink_t sink, void *priv, size_t *readSize, uint32_t timeout_ms)
+{
+	return read_stream(SDO_C, nodeId, index, subIndex, sink, priv, readSize, timeout_ms, true);
+}
+
+CO_SDO_abortCode_t write_SDO_stream(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, co_sdo_source_t source, void *priv, size_t dataSize, uint32_t timeout_ms)
+{
+	CO_SDO_return_t SDO_ret = CO_SDOclient_setup(SDO_C, CO_CAN_ID_SDO_CLI + nodeId, CO_CAN_ID_SDO_SRV + nodeId, nodeId);
+	if(SDO_ret != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+
+	const bool_t block = SDO_USE_BLOCK(SDO_C, nodeId & 0x7F, index, subIndex, true, dataSize, false);
+	CO_SDO_abortCode_t ret = download(SDO_C, index, subIndex, source, priv, dataSize, timeout_ms, block);
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	if(block && CO_SDO_BLOCK_REFUSED(ret))
+	{
+		bus(SDO_C)->blk_refused[nodeId & 0x7F] = true;
+		ret = download(SDO_C, index, subIndex, source, priv, dataSize, timeout_ms, false);
+	}
+#endif
+	if(!ret) SDO_SIZE_SEEN(SDO_C, nodeId & 0x7F, index, subIndex, dataSize);
+	return ret;
+}
+
+CO_SDO_abortCode_t read_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, uint8_t *buf, size_t bufSize, size_t *readSize, uint32_t timeout_ms)
+{
+	sdo_mem_t m = {buf, bufSize};
+	const CO_SDO_abortCode_t ret = read_stream(SDO_C, nodeId, index, subIndex, mem_sink, &m, readSize, timeout_ms, false);
+	if(*readSize > bufSize) *readSize = bufSize; // first bufSize bytes of a larger object
+	return ret;
+}
+
+CO_SDO_abortCode_t write_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, uint8_t *data, size_t dataSize, uint32_t timeout_ms)
+{
+	sdo_mem_t m = {data, dataSize};
+	return write_SDO_stream(SDO_C, nodeId, index, subIndex, mem_source, &m, dataSize, timeout_ms);
+}
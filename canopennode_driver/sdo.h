@@ -4,6 +4,7 @@
 #include "CANopen.h"
 #include <stdint.h>
 
+/* An object larger than bufSize is read completely, its first bufSize bytes are returned (*readSize = bufSize). */
 CO_SDO_abortCode_t read_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId,
 							uint16_t index, uint8_t subIndex,
 							uint8_t *buf, size_t bufSize, size_t *readSize,
@@ -14,4 +15,16 @@ CO_SDO_abortCode_t write_SDO(CO_SDOclient_t *SDO_C, uint8_t nodeId,
 							 uint8_t *data, size_t dataSize,
 							 uint32_t timeout_ms);
 
+/* Streaming variants: data goes to/comes from the callback in fifo sized chunks, nothing is buffered
+ * beyond the client fifo. The sink/source may see offset 0 again if the server refuses block transfer. */
+CO_SDO_abortCode_t read_SDO_stream(CO_SDOclient_t *SDO_C, uint8_t nodeId,
+								   uint16_t index, uint8_t subIndex,
+								   co_sdo_sink_t sink, void *priv, size_t *readSize,
+								   uint32_t timeout_ms);
+
+CO_SDO_abortCode_t write_SDO_stream(CO_SDOclient_t *SDO_C, uint8_t nodeId,
+									uint16_t index, uint8_t subIndex,
+									co_sdo_source_t source, void *priv, size_t dataSize,
+									uint32_t timeout_ms);
+
 #endif // SDO_H__
\ No newline at end of file
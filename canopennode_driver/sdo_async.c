@@ -0,0 +1,349 @@
+#include "sdo_async.h"
+#include "CANopen.h"
+#include <string.h>
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+
+#if defined(_WIN32)
+#define SDO_ASYNC_LOCK(s) EnterCriticalSection(&(s)->lock)
+#define SDO_ASYNC_UNLOCK(s) LeaveCriticalSection(&(s)->lock)
+#else
+#define SDO_ASYNC_LOCK(s) pthread_mutex_lock(&(s)->lock)
+#define SDO_ASYNC_UNLOCK(s) pthread_mutex_unlock(&(s)->lock)
+#endif
+
+void co_sdo_async_init(CO_sdo_async_t *s, CO_CANmodule_t *module, CO_SDOclient_t *cli, uint16_t cli_cnt, uint32_t timeout_ms)
+{
+	memset(s, 0, sizeof(*s));
+	s->module = module;
+	s->cli = cli;
+	s->cli_cnt = cli_cnt > 128 ? 128 : cli_cnt;
+	s->cli_first = s->cli_cnt > 1 ? 1 : 0;
+	s->timeout_ms = timeout_ms;
+#if defined(_WIN32)
+	InitializeCriticalSection(&s->lock);
+#else
+	pthread_mutex_init(&s->lock, NULL);
+#endif
+	s->run = true;
+}
+
+static void req_complete(CO_sdo_async_t *s, co_sdo_req_t *req, CO_SDO_abortCode_t result)
+{
+	s->node_busy[req->node_id] = false;
+	co_sdo_cb_t cb = req->cb;
+	req->result = result;
+	__atomic_store_n(&req->done, true, __ATOMIC_RELEASE);
+	if(cb) cb(req); // req may be released by the callback
+}
+
+void co_sdo_async_deinit(CO_sdo_async_t *s)
+{
+	if(!s->module) return;
+
+	SDO_ASYNC_LOCK(s);
+	s->run = false;
+	co_sdo_req_t *req = s->head;
+	s->head = s->tail = NULL;
+	SDO_ASYNC_UNLOCK(s);
+
+	for(uint16_t i = s->cli_first; i < s->cli_cnt; i++)
+	{
+		if(!s->active[i]) continue;
+		co_sdo_req_t *r = s->active[i];
+		s->active[i] = NULL;
+		CO_SDOclientClose(&s->cli[i]);
+		req_complete(s, r, CO_SDO_AB_GENERAL);
+	}
+	while(req)
+	{
+		co_sdo_req_t *next = req->next;
+		req_complete(s, req, CO_SDO_AB_GENERAL);
+		req = next;
+	}
+
+#if defined(_WIN32)
+	DeleteCriticalSection(&s->lock);
+#else
+	pthread_mutex_destroy(&s->lock);
+#endif
+	s->module = NULL;
+}
+
+int co_sdo_submit(CO_sdo_async_t *s, co_sdo_req_t *req)
+{
+	if(!req || req->node_id < 1 || req->node_id > 127) return 1;
+	if(req->write ? (!req->source && req->size && !req->buf) : (!req->sink && req->size && !req->buf)) return 1;
+
+	req->xfer_size = 0;
+	req->result = CO_SDO_AB_NONE;
+	req->done = false;
+	req->next = NULL;
+
+	SDO_ASYNC_LOCK(s);
+	if(!s->run)
+	{
+		SDO_ASYNC_UNLOCK(s);
+		return 2;
+	}
+	if(s->tail)
+		s->tail->next = req;
+	else
+		s->head = req;
+	s->tail = req;
+	SDO_ASYNC_UNLOCK(s);
+
+	CO_CANmodule_wakeup(s->module);
+	return 0;
+}
+
+int co_sdo_read(CO_sdo_async_t *s, co_sdo_req_t *req, uint8_t node_id, uint16_t index, uint8_t sub_index, uint8_t *buf, size_t size, co_sdo_cb_t cb, void *priv)
+{
+	req->node_id = node_id;
+	req->index = index;
+	req->sub_index = sub_index;
+	req->write = false;
+	req->buf = buf;
+	req->size = size;
+	req->sink = NULL;
+	req->source = NULL;
+	req->timeout_ms = 0;
+	req->cb = cb;
+	req->priv = priv;
+	return co_sdo_submit(s, req);
+}
+
+int co_sdo_write(CO_sdo_async_t *s, co_sdo_req_t *req, uint8_t node_id, uint16_t index, uint8_t sub_index, uint8_t *data, size_t size, co_sdo_cb_t cb, void *priv)
+{
+	req->node_id = node_id;
+	req->index = index;
+	req->sub_index = sub_index;
+	req->write = true;
+	req->buf = data;
+	req->size = size;
+	req->sink = NULL;
+	req->source = NULL;
+	req->timeout_ms = 0;
+	req->cb = cb;
+	req->priv = priv;
+	return co_sdo_submit(s, req);
+}
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+static uint32_t obj_key(uint8_t node_id, uint16_t index, uint8_t sub_index) { return (uint32_t)node_id << 24 | (uint32_t)index << 8 | sub_index; }
+static uint32_t obj_slot(uint32_t key) { return (key * 2654435761u) >> (32 - CO_SDO_SIZE_CACHE_BITS); }
+
+bool_t co_sdo_block(CO_sdo_async_t *s, uint8_t node_id, uint16_t index, uint8_t sub_index, bool_t write, size_t size, bool_t sink)
+{
+	if(s->blk_refused[node_id & 0x7F]) return false;
+	if(!write)
+	{
+		const uint32_t key = obj_key(node_id, index, sub_index);
+		const uint64_t e = __atomic_load_n(&s->obj_size[obj_slot(key)], __ATOMIC_RELAXED);
+		if((uint32_t)(e >> 32) != key) return sink; // never seen: a buffer is read segmented, the pst lets a server switch back
+		size = (uint32_t)e;
+	}
+	return size > CO_SDO_BLOCK_THRESHOLD;
+}
+
+void co_sdo_size_seen(CO_sdo_async_t *s, uint8_t node_id, uint16_t index, uint8_t sub_index, size_t size)
+{
+	const uint32_t key = obj_key(node_id, index, sub_index);
+	__atomic_store_n(&s->obj_size[obj_slot(key)], (uint64_t)key << 32 | (size > UINT32_MAX ? UINT32_MAX : size), __ATOMIC_RELAXED);
+}
+#endif
+
+// Moves data between the request and the client fifo; returns false when the caller's sink/source gave up
+static bool_t req_fill(CO_SDOclient_t *c, co_sdo_req_t *req)
+{
+	if(!req->source)
+	{
+		req->xfer_size += CO_SDOclientDownloadBufWrite(c, req->buf + req->xfer_size, req->size - req->xfer_size);
+		return true;
+	}
+	uint8_t chunk[256];
+	size_t space;
+	while(req->xfer_size < req->size && (space = CO_fifo_getSpace(&c->bufFifo)) > 0)
+	{
+		size_t n = req->size - req->xfer_size;
+		if(n > space) n = space;
+		if(n > sizeof(chunk)) n = sizeof(chunk);
+		if(req->source(req->stream, req->xfer_size, chunk, n) != n) return false;
+		req->xfer_size += CO_SDOclientDownloadBufWrite(c, chunk, n);
+	}
+	return true;
+}
+
+static bool_t req_drain(CO_SDOclient_t *c, co_sdo_req_t *req)
+{
+	if(!req->sink)
+	{
+		req->xfer_size += CO_SDOclientUploadBufRead(c, req->buf + req->xfer_size, req->size - req->xfer_size);
+		return CO_fifo_getOccupied(&c->bufFifo) == 0; // else it doesn't fit into the caller's buffer
+	}
+	uint8_t chunk[256];
+	size_t n;
+	while((n = CO_SDOclientUploadBufRead(c, chunk, sizeof(chunk))) > 0)
+	{
+		if(req->sink(req->stream, req->xfer_size, chunk, n) != n) return false;
+		req->xfer_size += n;
+	}
+	return true;
+}
+
+// Free client for the node: prefer one that is already set up for it (no CO_SDOclient_setup, no rx filter update)
+static int cli_pick(CO_sdo_async_t *s, uint8_t node_id)
+{
+	int free_cli = -1;
+	for(uint16_t i = s->cli_first; i < s->cli_cnt; i++)
+	{
+		if(s->active[i]) continue;
+		if(s->cli_node[i] == node_id) return i;
+		if(free_cli < 0 || (s->cli_node[free_cli] && !s->cli_node[i])) free_cli = i;
+	}
+	return free_cli;
+}
+
+static CO_SDO_abortCode_t cli_start(CO_sdo_async_t *s, uint16_t i, co_sdo_req_t *req)
+{
+	CO_SDOclient_t *c = &s->cli[i];
+	if(s->cli_node[i] != req->node_id)
+	{
+		// At most one client per node: the rx dispatch hands a COB-ID to every matching buffer, two active clients would
+		// both take the server's responses
+		s->cli_node[i] = 0;
+		if(CO_SDOclient_setup(c, CO_CAN_ID_SDO_CLI + req->node_id, CO_CAN_ID_SDO_SRV + req->node_id, req->node_id) != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+		s->cli_node[i] = req->node_id;
+	}
+
+	const uint32_t timeout_ms = req->timeout_ms ? req->timeout_ms : s->timeout_ms;
+	const uint16_t tmo = timeout_ms > 0xFFFF ? 0xFFFF : (uint16_t)timeout_ms;
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	const bool_t block = co_sdo_block(s, req->node_id, req->index, req->sub_index, req->write, req->size, req->sink != NULL);
+	s->cli_block[i] = block;
+#else
+	const bool_t block = false;
+#endif
+	req->xfer_size = 0;
+	if(req->write)
+	{
+		if(CO_SDOclientDownloadInitiate(c, req->index, req->sub_index, req->size, tmo, block) != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+		if(!req_fill(c, req))
+		{
+			CO_SDOclientClose(c);
+			return CO_SDO_AB_DATA_LOC_CTRL;
+		}
+	}
+	else
+	{
+		if(CO_SDOclientUploadInitiate(c, req->index, req->sub_index, tmo, block) != CO_SDO_RT_ok_communicationEnd) return CO_SDO_AB_GENERAL;
+	}
+	return CO_SDO_AB_NONE;
+}
+
+// Returns true while the transfer runs
+static bool_t cli_process(CO_sdo_async_t *s, uint16_t i, uint32_t dt_us, uint32_t *timer_next_us)
+{
+	CO_SDOclient_t *c = &s->cli[i];
+	co_sdo_req_t *req = s->active[i];
+	CO_SDO_abortCode_t abort_code = CO_SDO_AB_NONE;
+	CO_SDO_return_t ret;
+
+	if(req->write)
+	{
+		bool_t abort = false;
+		if(req->xfer_size < req->size && !req_fill(c, req))
+		{
+			abort = true;
+			abort_code = CO_SDO_AB_DATA_LOC_CTRL;
+		}
+		ret = CO_SDOclientDownload(c, dt_us, abort, req->xfer_size < req->size, &abort_code, NULL, timer_next_us);
+	}
+	else
+	{
+		ret = CO_SDOclientUpload(c, dt_us, false, &abort_code, NULL, NULL, timer_next_us);
+		if(ret == CO_SDO_RT_uploadDataBufferFull || ret == CO_SDO_RT_ok_communicationEnd)
+		{
+			if(!req_drain(c, req))
+			{
+				abort_code = CO_SDO_AB_OUT_OF_MEM;
+				if(ret != CO_SDO_RT_ok_communicationEnd) CO_SDOclientUpload(c, 0, true, &abort_code, NULL, NULL, NULL);
+				ret = CO_SDO_RT_endedWithClientAbort;
+			}
+		}
+	}
+	if(ret == CO_SDO_RT_transmittBufferFull) *timer_next_us = 0; // next segment as soon as the CANopen thread flushed this one
+	if(ret > 0) return true;
+
+	CO_SDOclientClose(c);
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	if(ret < 0 && s->cli_block[i] && CO_SDO_BLOCK_REFUSED(abort_code))
+	{
+		// no block support on the server, run it again segmented
+		s->blk_refused[req->node_id] = true;
+		if(cli_start(s, i, req) == CO_SDO_AB_NONE) return cli_process(s, i, 0, timer_next_us);
+	}
+#endif
+	s->active[i] = NULL;
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	if(ret >= 0) co_sdo_size_seen(s, req->node_id, req->index, req->sub_index, req->xfer_size);
+#endif
+	if(ret < 0 && abort_code == CO_SDO_AB_NONE) abort_code = CO_SDO_AB_GENERAL;
+	req_complete(s, req, ret < 0 ? abort_code : CO_SDO_AB_NONE);
+	return false;
+}
+
+void co_sdo_async_poll(CO_sdo_async_t *s, uint32_t dt_us, uint32_t *timer_next_us)
+{
+	if(!s->module) return;
+
+	for(uint16_t i = s->cli_first; i < s->cli_cnt; i++)
+	{
+		if(s->active[i]) cli_process(s, i, dt_us, timer_next_us);
+	}
+
+	if(!__atomic_load_n(&s->head, __ATOMIC_ACQUIRE)) return;
+
+	// Start queued requests in order, skipping nodes that are busy (keeps per-node order)
+	uint8_t start[128];
+	uint16_t start_cnt = 0, free_cnt = 0;
+	for(uint16_t i = s->cli_first; i < s->cli_cnt; i++) free_cnt += s->active[i] ? 0 : 1;
+
+	SDO_ASYNC_LOCK(s);
+	co_sdo_req_t **pp = &s->head, *prev = NULL;
+	while(*pp && start_cnt < free_cnt)
+	{
+		co_sdo_req_t *req = *pp;
+		int i = -1;
+		if(!s->node_busy[req->node_id]) i = cli_pick(s, req->node_id);
+		if(i < 0)
+		{
+			prev = req;
+			pp = &req->next;
+			continue;
+		}
+		*pp = req->next;
+		if(s->tail == req) s->tail = prev;
+		req->next = NULL;
+		s->node_busy[req->node_id] = true;
+		s->active[i] = req; // reserve, started below
+		start[start_cnt++] = (uint8_t)i;
+	}
+	SDO_ASYNC_UNLOCK(s);
+
+	for(uint16_t n = 0; n < start_cnt; n++)
+	{
+		const uint16_t i = start[n];
+		co_sdo_req_t *req = s->active[i];
+		CO_SDO_abortCode_t err = cli_start(s, i, req);
+		if(err != CO_SDO_AB_NONE)
+		{
+			s->active[i] = NULL;
+			req_complete(s, req, err);
+			continue;
+		}
+		cli_process(s, i, 0, timer_next_us); // sends the initiate request now
+	}
+}
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef SDO_ASYNC_H__
+#define SDO_ASYNC_H__
+
+#include "301/CO_SDOclient.h"
+#include "CO_driver_target.h"
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_ENABLE
+
+#define CO_SDO_ASYNC_NODES 128 // node-ID 1..127
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+// Block transfer is requested for larger data only (default server protocol switch threshold)
+#ifndef CO_SDO_BLOCK_THRESHOLD
+#define CO_SDO_BLOCK_THRESHOLD 21
+#endif
+// Upload sizes seen per node/object, an upload starts in block mode only when the object was larger last time
+#ifndef CO_SDO_SIZE_CACHE_BITS
+#define CO_SDO_SIZE_CACHE_BITS 6
+#endif
+// Abort codes of servers without block support, the transfer is retried segmented
+#define CO_SDO_BLOCK_REFUSED(abort_code) ((abort_code) == CO_SDO_AB_CMD || (abort_code) == CO_SDO_AB_BLOCK_SIZE)
+#endif
+
+typedef struct co_sdo_req_t co_sdo_req_t;
+typedef void (*co_sdo_cb_t)(co_sdo_req_t *req);
+
+/* Streaming: data is passed as the client fifo fills/empties, 'offset' is the position in the transfer.
+ * A transfer restarts from offset 0 when it falls back from block to segmented mode. */
+typedef size_t (*co_sdo_sink_t)(void *priv, size_t offset, const uint8_t *data, size_t len); // returns bytes stored, less than len aborts the upload
+typedef size_t (*co_sdo_source_t)(void *priv, size_t offset, uint8_t *buf, size_t len);		// returns bytes provided, less than len aborts the download
+
+/**
+ * One SDO transfer. Filled by the caller and owned by the engine from co_sdo_submit() until
+ * completion: either poll 'done' or get the callback (called from the CANopen thread).
+ */
+struct co_sdo_req_t
+{
+	uint8_t node_id;
+	uint16_t index;
+	uint8_t sub_index;
+	bool_t write;
+	uint8_t *buf;		 // upload destination / download source
+	size_t size;		 // size of buf / download size
+	uint32_t timeout_ms; // 0 - use the client default
+
+	// optional, used instead of buf (size is the download size, an upload sink takes any size)
+	co_sdo_sink_t sink;
+	co_sdo_source_t source;
+	void *stream;
+
+	co_sdo_cb_t cb; // optional
+	void *priv;
+
+	// results
+	size_t xfer_size;
+	volatile CO_SDO_abortCode_t result;
+	volatile bool_t done;
+
+	co_sdo_req_t *next;
+};
+
+typedef struct
+{
+	CO_CANmodule_t *module;
+	CO_SDOclient_t *cli;
+	uint16_t cli_first, cli_cnt;		 // SDOclient[0] stays with read_SDO()/write_SDO() and the gateway
+	co_sdo_req_t *active[128];			 // per client
+	uint8_t cli_node[128];				 // node the client is set up for, 0 - none
+	bool_t node_busy[CO_SDO_ASYNC_NODES]; // one transfer per node at a time, others wait in the queue
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+	bool_t cli_block[128];				   // running transfer was started in block mode
+	bool_t blk_refused[CO_SDO_ASYNC_NODES]; // stay segmented for the node
+	uint64_t obj_size[1u << CO_SDO_SIZE_CACHE_BITS]; // node/index/sub << 32 | size of the last transfer, direct mapped
+#endif
+	uint32_t timeout_ms;
+
+	co_sdo_req_t *head, *tail; // pending, FIFO
+#if defined(_WIN32)
+	CRITICAL_SECTION lock;
+#else
+	pthread_mutex_t lock;
+#endif
+	bool_t run;
+} CO_sdo_async_t;
+
+void co_sdo_async_init(CO_sdo_async_t *s, CO_CANmodule_t *module, CO_SDOclient_t *cli, uint16_t cli_cnt, uint32_t timeout_ms);
+void co_sdo_async_deinit(CO_sdo_async_t *s);
+// Called from the CANopen thread: advances running transfers and starts queued ones
+void co_sdo_async_poll(CO_sdo_async_t *s, uint32_t dt_us, uint32_t *timer_next_us);
+
+// Thread safe; returns 0 when queued
+int co_sdo_submit(CO_sdo_async_t *s, co_sdo_req_t *req);
+int co_sdo_read(CO_sdo_async_t *s, co_sdo_req_t *req, uint8_t node_id, uint16_t index, uint8_t sub_index, uint8_t *buf, size_t size, co_sdo_cb_t cb, void *priv);
+int co_sdo_write(CO_sdo_async_t *s, co_sdo_req_t *req, uint8_t node_id, uint16_t index, uint8_t sub_index, uint8_t *data, size_t size, co_sdo_cb_t cb, void *priv);
+
+#if(CO_CONFIG_SDO_CLI) & CO_CONFIG_SDO_CLI_BLOCK
+/* Block or segmented from the transfer size: a download's is known; for an upload it is the size the object had on the
+ * last transfer (any thread, read_SDO() shares the table), 0 if not known: block for a sink of unknown size only.
+ * Servers without block support are remembered per node. */
+bool_t co_sdo_block(CO_sdo_async_t *s, uint8_t node_id, uint16_t index, uint8_t sub_index, bool_t write, size_t size, bool_t sink);
+void co_sdo_size_seen(CO_sdo_async_t *s, uint8_t node_id, uint16_t index, uint8_t sub_index, size_t size);
+#endif
+
+#endif
+
+#endif // SDO_ASYNC_H__
@@ -0,0 +1,188 @@
+#include "sdo_file.h"
+#include <string.h>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define SDO_FILE_MIN_CAP (1024 * 1024) // sink mapping grows by doubling from here
+
+#if defined(_WIN32)
+static int map_view(sdo_file_t *f, size_t len)
+{
+	f->mapping = CreateFileMappingA(f->file, NULL, f->write ? PAGE_READWRITE : PAGE_READONLY, (DWORD)((uint64_t)len >> 32), (DWORD)len, NULL);
+	if(!f->mapping) return 1;
+	f->map = MapViewOfFile(f->mapping, f->write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, len);
+	if(!f->map)
+	{
+		CloseHandle(f->mapping);
+		f->mapping = NULL;
+		return 1;
+	}
+	f->cap = len;
+	return 0;
+}
+
+static void unmap_view(sdo_file_t *f)
+{
+	if(f->map) UnmapViewOfFile(f->map);
+	if(f->mapping) CloseHandle(f->mapping);
+	f->map = NULL;
+	f->mapping = NULL;
+	f->cap = 0;
+}
+
+int sdo_file_open_read(sdo_file_t *f, const char *path)
+{
+	memset(f, 0, sizeof(*f));
+	f->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if(f->file == INVALID_HANDLE_VALUE) return 1;
+	LARGE_INTEGER sz;
+	if(!GetFileSizeEx(f->file, &sz) || (uint64_t)sz.QuadPart > SIZE_MAX)
+	{
+		CloseHandle(f->file);
+		return 1;
+	}
+	f->size = (size_t)sz.QuadPart;
+	if(f->size && map_view(f, f->size))
+	{
+		CloseHandle(f->file);
+		return 1;
+	}
+	return 0;
+}
+
+int sdo_file_open_write(sdo_file_t *f, const char *path)
+{
+	memset(f, 0, sizeof(*f));
+	f->write = true;
+	f->file = CreateFileA(path, GENERIC_READ | GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+	return f->file == INVALID_HANDLE_VALUE ? 1 : 0;
+}
+
+// CreateFileMapping extends the file to the mapping size
+static int grow(sdo_file_t *f, size_t need)
+{
+	size_t cap = f->cap ? f->cap : SDO_FILE_MIN_CAP;
+	while(cap < need) cap *= 2;
+	unmap_view(f);
+	return map_view(f, cap);
+}
+
+int sdo_file_close(sdo_file_t *f)
+{
+	int ret = 0;
+	if(f->map && f->write && !FlushViewOfFile(f->map, f->size)) ret = 1;
+	unmap_view(f);
+	if(f->write)
+	{
+		LARGE_INTEGER sz;
+		sz.QuadPart = (LONGLONG)f->size;
+		if(!SetFilePointerEx(f->file, sz, NULL, FILE_BEGIN) || !SetEndOfFile(f->file)) ret = 1;
+	}
+	CloseHandle(f->file);
+	f->file = INVALID_HANDLE_VALUE;
+	return ret;
+}
+#else
+int sdo_file_open_read(sdo_file_t *f, const char *path)
+{
+	memset(f, 0, sizeof(*f));
+	f->fd = open(path, O_RDONLY);
+	if(f->fd < 0) return 1;
+	struct stat st;
+	if(fstat(f->fd, &st) != 0)
+	{
+		close(f->fd);
+		return 1;
+	}
+	f->size = (size_t)st.st_size;
+	if(f->size)
+	{
+		void *p = mmap(NULL, f->size, PROT_READ, MAP_SHARED, f->fd, 0);
+		if(p == MAP_FAILED)
+		{
+			close(f->fd);
+			return 1;
+		}
+		madvise(p, f->size, MADV_SEQUENTIAL);
+		f->map = p;
+		f->cap = f->size;
+	}
+	return 0;
+}
+
+int sdo_file_open_write(sdo_file_t *f, const char *path)
+{
+	memset(f, 0, sizeof(*f));
+	f->write = true;
+	f->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	return f->fd < 0 ? 1 : 0;
+}
+
+static int grow(sdo_file_t *f, size_t need)
+{
+	size_t cap = f->cap ? f->cap : SDO_FILE_MIN_CAP;
+	while(cap < need) cap *= 2;
+	if(ftruncate(f->fd, (off_t)cap) != 0) return 1;
+	if(f->map) munmap(f->map, f->cap);
+	void *p = mmap(NULL, cap, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+	f->map = p == MAP_FAILED ? NULL : p;
+	f->cap = f->map ? cap : 0;
+	if(!f->map) return 1;
+	madvise(p, cap, MADV_SEQUENTIAL);
+	return 0;
+}
+
+int sdo_file_close(sdo_file_t *f)
+{
+	int ret = 0;
+	if(f->map) munmap(f->map, f->cap);
+	f->map = NULL;
+	if(f->write && ftruncate(f->fd, (off_t)f->size) != 0) ret = 1;
+	if(close(f->fd) != 0) ret = 1;
+	f->fd = -1;
+	return ret;
+}
+#endif
+
+size_t sdo_file_sink(void *priv, size_t offset, const uint8_t *data, size_t len)
+{
+	sdo_file_t *f = priv;
+	if(offset + len > f->cap && grow(f, offset + len)) return 0;
+	memcpy(f->map + offset, data, len);
+	f->size = offset + len; // offset restarts from 0 on a block -> segmented retry
+	return len;
+}
+
+size_t sdo_file_source(void *priv, size_t offset, uint8_t *buf, size_t len)
+{
+	sdo_file_t *f = priv;
+	if(offset >= f->size) return 0;
+	if(len > f->size - offset) len = f->size - offset;
+	memcpy(buf, f->map + offset, len);
+	return len;
+}
+
+CO_SDO_abortCode_t read_SDO_file(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, const char *path, size_t *readSize, uint32_t timeout_ms)
+{
+	sdo_file_t f;
+	*readSize = 0;
+	if(sdo_file_open_write(&f, path)) return CO_SDO_AB_DATA_LOC_CTRL;
+	CO_SDO_abortCode_t ret = read_SDO_stream(SDO_C, nodeId, index, subIndex, sdo_file_sink, &f, readSize, timeout_ms);
+	if(ret != CO_SDO_AB_NONE) f.size = 0; // don't leave partial data behind
+	if(sdo_file_close(&f) && ret == CO_SDO_AB_NONE) ret = CO_SDO_AB_DATA_LOC_CTRL;
+	return ret;
+}
+
+CO_SDO_abortCode_t write_SDO_file(CO_SDOclient_t *SDO_C, uint8_t nodeId, uint16_t index, uint8_t subIndex, const char *path, uint32_t timeout_ms)
+{
+	sdo_file_t f;
+	if(sdo_file_open_read(&f, path)) return CO_SDO_AB_DATA_LOC_CTRL;
+	CO_SDO_abortCode_t ret = write_SDO_stream(SDO_C, nodeId, index, subIndex, sdo_file_source, &f, f.size, timeout_ms);
+	sdo_file_close(&f);
+	return ret;
+}
@@ -0,0 +1,48 @@
+#ifndef SDO_FILE_H__
+#define SDO_FILE_H__
+
+#include "sdo.h"
+#include <stdint.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+/**
+ * Memory mapped file as an SDO stream sink/source, the data goes straight between the
+ * client fifo and the page cache. Usable with read_SDO_stream()/write_SDO_stream() and
+ * co_sdo_req_t (sink/source + stream).
+ */
+typedef struct
+{
+	uint8_t *map;
+	size_t size; // file size (source) / data written so far (sink)
+	size_t cap;	 // mapped length
+	bool_t write;
+#if defined(_WIN32)
+	HANDLE file, mapping;
+#else
+	int fd;
+#endif
+} sdo_file_t;
+
+// Returns 0 on success
+int sdo_file_open_read(sdo_file_t *f, const char *path);
+int sdo_file_open_write(sdo_file_t *f, const char *path);
+// Unmaps, a written file is truncated to the data size
+int sdo_file_close(sdo_file_t *f);
+
+size_t sdo_file_sink(void *priv, size_t offset, const uint8_t *data, size_t len);
+size_t sdo_file_source(void *priv, size_t offset, uint8_t *buf, size_t len);
+
+CO_SDO_abortCode_t read_SDO_file(CO_SDOclient_t *SDO_C, uint8_t nodeId,
+								 uint16_t index, uint8_t subIndex,
+								 const char *path, size_t *readSize,
+								 uint32_t timeout_ms);
+
+CO_SDO_abortCode_t write_SDO_file(CO_SDOclient_t *SDO_C, uint8_t nodeId,
+								  uint16_t index, uint8_t subIndex,
+								  const char *path,
+								  uint32_t timeout_ms);
+
+#endif // SDO_FILE_H__
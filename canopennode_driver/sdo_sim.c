@@ -0,0 +1,465 @@
+#define _GNU_SOURCE
+#include "sdo_sim.h"
+
+#if defined(__linux__)
+#include "301/CO_SDOserver.h"
+#include "301/crc16-ccitt.h"
+#include "slcan.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define SIM_BLKSIZE 127
+
+typedef struct
+{
+	uint16_t index;
+	uint8_t sub;
+	bool writable;
+	uint8_t *data;
+	size_t size, max;
+} sim_obj_t;
+
+typedef struct
+{
+	enum
+	{
+		ST_IDLE,
+		ST_DN_SEG,
+		ST_UP_SEG,
+		ST_UP_BLK,
+		ST_DN_BLK,
+		ST_DN_BLK_END,
+	} st;
+	sim_obj_t *obj;
+	size_t pos, size, blk_start;
+	uint8_t blksize, seqno;
+} sim_xfer_t;
+
+static struct
+{
+	sdo_sim_cfg_t cfg;
+	int fd;
+	sim_obj_t obj[4];
+	sim_xfer_t xfer[2]; // node_blk, node_seg
+} sim;
+
+static sdo_sim_shared_t *shared;
+
+static uint8_t dev_type[4] = {0x91, 0x01, 0x0F, 0x00};
+static uint8_t dev_name[] = "stand-in slave";
+static uint8_t hb_time[2] = {0xE8, 0x03};
+
+static void sim_write(const uint8_t *buf, size_t len)
+{
+	while(len)
+	{
+		ssize_t l = write(sim.fd, buf, len);
+		if(l <= 0) return;
+		buf += l;
+		len -= (size_t)l;
+	}
+}
+
+static size_t sim_encode(uint8_t node, const uint8_t d[8], uint8_t *buf)
+{
+	can_msg_t msg = {.id.std = CO_CAN_ID_SDO_SRV + node, .DLC = 8};
+	memcpy(msg.data, d, 8);
+	shared->frames_tx++;
+	return (size_t)slcan_encode(&msg, buf);
+}
+
+static void sim_respond(uint8_t node, const uint8_t d[8])
+{
+	uint8_t buf[SLCAN_MAX_FRAME_SIZE];
+	if(sim.cfg.delay_us) usleep(sim.cfg.delay_us);
+	sim_write(buf, sim_encode(node, d, buf));
+}
+
+static void sim_abort(sim_xfer_t *x, uint8_t node, const uint8_t *req, uint32_t code)
+{
+	uint8_t r[8] = {0x80, req[1], req[2], req[3], (uint8_t)code, (uint8_t)(code >> 8), (uint8_t)(code >> 16), (uint8_t)(code >> 24)};
+	x->st = ST_IDLE;
+	sim_respond(node, r);
+}
+
+static void put_size(uint8_t *r, size_t size)
+{
+	r[4] = (uint8_t)size;
+	r[5] = (uint8_t)(size >> 8);
+	r[6] = (uint8_t)(size >> 16);
+	r[7] = (uint8_t)(size >> 24);
+}
+
+// Block upload: one sub-block from x->pos, written at once
+static void sim_blk_upload(sim_xfer_t *x, uint8_t node)
+{
+	static uint8_t buf[SIM_BLKSIZE * SLCAN_MAX_FRAME_SIZE];
+	size_t l = 0;
+	x->blk_start = x->pos;
+	for(uint8_t seq = 1; seq <= x->blksize && x->pos < x->size; seq++)
+	{
+		const size_t n = x->size - x->pos < 7 ? x->size - x->pos : 7;
+		uint8_t d[8] = {seq};
+		memcpy(&d[1], &x->obj->data[x->pos], n);
+		x->pos += n;
+		if(x->pos >= x->size) d[0] |= 0x80;
+		l += sim_encode(node, d, &buf[l]);
+	}
+	if(sim.cfg.delay_us) usleep(sim.cfg.delay_us);
+	sim_write(buf, l);
+}
+
+static void obj_size(sim_obj_t *o, size_t size)
+{
+	o->size = size;
+	if(o->data == shared->domain) shared->domain_size = size;
+}
+
+static sim_obj_t *sim_find(const uint8_t *d)
+{
+	const uint16_t index = (uint16_t)(d[2] << 8 | d[1]);
+	for(size_t i = 0; i < sizeof(sim.obj) / sizeof(sim.obj[0]); i++)
+		if(sim.obj[i].index == index && sim.obj[i].sub == d[3]) return &sim.obj[i];
+	return NULL;
+}
+
+static void sim_process(sim_xfer_t *x, uint8_t node, const uint8_t *d)
+{
+	const bool block_ok = node == sim.cfg.node_blk;
+	uint8_t r[8] = {0, d[1], d[2], d[3]};
+	shared->frames_rx++;
+
+	if(x->st == ST_DN_BLK)
+	{
+		const uint8_t seq = d[0] & 0x7F;
+		if(seq != x->seqno + 1)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_SEQ_NUM);
+			return;
+		}
+		x->seqno = seq;
+		if(x->pos + 7 <= x->obj->max) memcpy(&x->obj->data[x->pos], &d[1], 7);
+		x->pos += 7;
+		if(seq == x->blksize || (d[0] & 0x80))
+		{
+			uint8_t a[8] = {0xA2, seq, SIM_BLKSIZE};
+			x->seqno = 0;
+			if(d[0] & 0x80) x->st = ST_DN_BLK_END;
+			sim_respond(node, a);
+		}
+		return;
+	}
+
+	// only initiate requests carry index and sub-index
+	const bool initiate = (d[0] & 0xE0) == 0x20 || (d[0] & 0xE0) == 0x40 || d[0] == 0xA4 || (d[0] & 0xE1) == 0xC0;
+	if(initiate)
+	{
+		x->obj = sim_find(d);
+		if(!x->obj)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_NOT_EXIST);
+			return;
+		}
+		if(!x->obj->writable && ((d[0] & 0xE0) == 0x20 || (d[0] & 0xE1) == 0xC0))
+		{
+			sim_abort(x, node, d, CO_SDO_AB_READONLY);
+			return;
+		}
+	}
+	sim_obj_t *o = x->obj;
+
+	switch(d[0] >> 5)
+	{
+	case 1: // download initiate
+		if(d[0] & 0x02) // expedited
+		{
+			const size_t n = (d[0] & 0x01) ? 4 - ((d[0] >> 2) & 0x03) : 4;
+			if(n > o->max)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_DATA_LONG);
+				return;
+			}
+			memcpy(o->data, &d[4], n);
+			obj_size(o, n);
+			x->st = ST_IDLE;
+		}
+		else
+		{
+			x->size = (d[0] & 0x01) ? (size_t)(d[4] | d[5] << 8 | d[6] << 16 | (uint32_t)d[7] << 24) : 0;
+			if(x->size > o->max)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_DATA_LONG);
+				return;
+			}
+			x->pos = 0;
+			x->st = ST_DN_SEG;
+		}
+		r[0] = 0x60;
+		sim_respond(node, r);
+		return;
+	case 0: // download segment, the whole frame is data
+	{
+		if(x->st != ST_DN_SEG)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_CMD);
+			return;
+		}
+		const size_t n = 7 - ((d[0] >> 1) & 0x07);
+		if(x->pos + n > o->max)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_DATA_LONG);
+			return;
+		}
+		memcpy(&o->data[x->pos], &d[1], n);
+		x->pos += n;
+		if(d[0] & 0x01)
+		{
+			obj_size(o, x->pos);
+			x->st = ST_IDLE;
+		}
+		uint8_t a[8] = {(uint8_t)(0x20 | (d[0] & 0x10))};
+		sim_respond(node, a);
+		return;
+	}
+	case 2: // upload initiate
+		if(o->size && o->size <= 4)
+		{
+			r[0] = (uint8_t)(0x43 | ((4 - o->size) << 2));
+			memcpy(&r[4], o->data, o->size);
+			x->st = ST_IDLE;
+		}
+		else
+		{
+			x->size = o->size;
+			x->pos = 0;
+			x->st = ST_UP_SEG;
+			r[0] = 0x41;
+			put_size(r, x->size);
+		}
+		sim_respond(node, r);
+		return;
+	case 3: // upload segment
+	{
+		if(x->st != ST_UP_SEG)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_CMD);
+			return;
+		}
+		const size_t n = x->size - x->pos < 7 ? x->size - x->pos : 7;
+		uint8_t a[8] = {(uint8_t)((d[0] & 0x10) | ((7 - n) << 1))};
+		memcpy(&a[1], &o->data[x->pos], n);
+		x->pos += n;
+		if(x->pos >= x->size)
+		{
+			a[0] |= 0x01;
+			x->st = ST_IDLE;
+		}
+		sim_respond(node, a);
+		return;
+	}
+	case 5: // block upload
+		if(!block_ok)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_CMD);
+			return;
+		}
+		switch(d[0] & 0x03)
+		{
+		case 0: // initiate
+			x->size = o->size;
+			x->pos = 0;
+			x->blksize = d[4];
+			if(x->blksize < 1 || x->blksize > 127)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_BLOCK_SIZE);
+				return;
+			}
+			x->st = ST_UP_BLK;
+			r[0] = 0xC6; // crc, size indicated
+			put_size(r, x->size);
+			sim_respond(node, r);
+			return;
+		case 3: // start
+			if(x->st != ST_UP_BLK)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_CMD);
+				return;
+			}
+			sim_blk_upload(x, node);
+			return;
+		case 2: // sub-block acknowledged
+		{
+			if(x->st != ST_UP_BLK)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_CMD);
+				return;
+			}
+			const size_t acked = x->blk_start + (size_t)d[1] * 7;
+			x->pos = acked < x->size ? acked : x->size;
+			x->blksize = d[2];
+			if(x->pos < x->size)
+			{
+				sim_blk_upload(x, node);
+				return;
+			}
+			const uint8_t no_data = (uint8_t)((7 - x->size % 7) % 7);
+			const uint16_t crc = crc16_ccitt(o->data, x->size, 0);
+			uint8_t a[8] = {(uint8_t)(0xC1 | (no_data << 2)), (uint8_t)crc, (uint8_t)(crc >> 8)};
+			sim_respond(node, a);
+			return;
+		}
+		default: // end
+			x->st = ST_IDLE;
+			return;
+		}
+	case 6: // block download
+		if(!block_ok)
+		{
+			sim_abort(x, node, d, CO_SDO_AB_CMD);
+			return;
+		}
+		if((d[0] & 0x01) == 0) // initiate
+		{
+			x->size = (d[0] & 0x02) ? (size_t)(d[4] | d[5] << 8 | d[6] << 16 | (uint32_t)d[7] << 24) : 0;
+			if(x->size > o->max)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_DATA_LONG);
+				return;
+			}
+			x->pos = 0;
+			x->seqno = 0;
+			x->blksize = SIM_BLKSIZE;
+			x->st = ST_DN_BLK;
+			r[0] = 0xA4; // crc
+			r[4] = SIM_BLKSIZE;
+			sim_respond(node, r);
+			return;
+		}
+		else // end
+		{
+			if(x->st != ST_DN_BLK_END)
+			{
+				sim_abort(x, node, d, CO_SDO_AB_CMD);
+				return;
+			}
+			x->pos -= (d[0] >> 2) & 0x07;
+			if(crc16_ccitt(o->data, x->pos, 0) != (uint16_t)(d[1] | d[2] << 8))
+			{
+				sim_abort(x, node, d, CO_SDO_AB_CRC);
+				return;
+			}
+			obj_size(o, x->pos);
+			x->st = ST_IDLE;
+			uint8_t a[8] = {0xA1};
+			sim_respond(node, a);
+			return;
+		}
+	case 4: // abort from the client
+		x->st = ST_IDLE;
+		return;
+	default:
+		sim_abort(x, node, d, CO_SDO_AB_CMD);
+		return;
+	}
+}
+
+static int hex(char c) { return c <= '9' ? c - '0' : (c & ~0x20) - 'A' + 10; }
+
+static void sim_run(void)
+{
+	char line[64];
+	size_t pos = 0;
+	static uint8_t buf[65536];
+	for(;;)
+	{
+		ssize_t len = read(sim.fd, buf, sizeof(buf));
+		if(len <= 0)
+		{
+			if(len < 0 && errno != EAGAIN && errno != EINTR && errno != EIO) return;
+			usleep(100); // EIO until the client opened the slave side
+			continue;
+		}
+		for(ssize_t i = 0; i < len; i++)
+		{
+			if(buf[i] != '\r')
+			{
+				if(pos < sizeof(line) - 1) line[pos++] = (char)buf[i];
+				continue;
+			}
+			line[pos] = 0;
+			const size_t l = pos;
+			pos = 0;
+			if(line[0] != 't' || l < 5 + 16 || line[4] != '8') continue; // optional timestamp follows
+			const uint16_t id = (uint16_t)(hex(line[1]) << 8 | hex(line[2]) << 4 | hex(line[3]));
+			if((id & 0x780) != CO_CAN_ID_SDO_CLI) continue;
+			const uint8_t node = id & 0x7F;
+			if(node != sim.cfg.node_blk && node != sim.cfg.node_seg) continue;
+			uint8_t d[8];
+			for(int k = 0; k < 8; k++)
+				d[k] = (uint8_t)(hex(line[5 + 2 * k]) << 4 | hex(line[6 + 2 * k]));
+			sim_process(&sim.xfer[node == sim.cfg.node_blk ? 0 : 1], node, d);
+		}
+	}
+}
+
+pid_t sdo_sim_start(const sdo_sim_cfg_t *cfg, char *port_name, size_t port_name_size)
+{
+	if(!shared)
+	{
+		void *p = mmap(NULL, sizeof(*shared), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+		if(p == MAP_FAILED) return -1;
+		shared = p;
+	}
+	const int fd = posix_openpt(O_RDWR | O_NOCTTY);
+	if(fd < 0 || grantpt(fd) || unlockpt(fd) || !ptsname(fd))
+	{
+		if(fd >= 0) close(fd);
+		sdo_sim_stop(0);
+		return -1;
+	}
+	struct termios t;
+	tcgetattr(fd, &t);
+	cfmakeraw(&t);
+	tcsetattr(fd, TCSANOW, &t);
+	snprintf(port_name, port_name_size, "%s", ptsname(fd));
+
+	const pid_t pid = fork();
+	if(pid != 0)
+	{
+		close(fd);
+		return pid;
+	}
+
+	memset(&sim, 0, sizeof(sim));
+	sim.cfg = *cfg;
+	shared->domain_size = 0;
+	sim.fd = fd;
+	sim.obj[0] = (sim_obj_t){0x1000, 0, false, dev_type, sizeof(dev_type), sizeof(dev_type)};
+	sim.obj[1] = (sim_obj_t){0x1008, 0, false, dev_name, sizeof(dev_name) - 1, sizeof(dev_name) - 1};
+	sim.obj[2] = (sim_obj_t){0x1017, 0, true, hb_time, sizeof(hb_time), sizeof(hb_time)};
+	sim.obj[3] = (sim_obj_t){0x2000, 0, true, shared->domain, 0, sizeof(shared->domain)};
+	sim_run();
+	_exit(0);
+}
+
+void sdo_sim_stop(pid_t pid)
+{
+	if(pid > 0)
+	{
+		kill(pid, SIGTERM);
+		waitpid(pid, NULL, 0);
+	}
+	if(shared) munmap(shared, sizeof(*shared));
+	shared = NULL;
+}
+
+sdo_sim_shared_t *sdo_sim_shared(void) { return shared; }
+#endif
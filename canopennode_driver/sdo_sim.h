@@ -0,0 +1,40 @@
+#ifndef SDO_SIM_H__
+#define SDO_SIM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <sys/types.h>
+
+/**
+ * Stand-in SDO server for the benchmarks: a child process on the slave side of a pty speaking SLCAN.
+ * It answers expedited, segmented and block transfers for
+ * 	0x1000:0 UNSIGNED32 ro, 0x1008:0 VISIBLE_STRING ro, 0x1017:0 UNSIGNED16 rw, 0x2000:0 DOMAIN rw (SDO_SIM_DOMAIN_MAX)
+ * on node_blk, node_seg answers the same objects but refuses block transfers (abort 0x05040001).
+ * Start it before the CANopen thread exists: fork() copies only the calling thread.
+ */
+#define SDO_SIM_DOMAIN_MAX (1024 * 1024)
+
+typedef struct
+{
+	uint8_t node_blk, node_seg;
+	uint32_t delay_us; // before each response, models the bus round trip
+} sdo_sim_cfg_t;
+
+// Shared with the server process, valid from sdo_sim_start() to sdo_sim_stop()
+typedef struct
+{
+	volatile uint32_t frames_rx, frames_tx;
+	volatile size_t domain_size;
+	uint8_t domain[SDO_SIM_DOMAIN_MAX]; // 0x2000:0
+} sdo_sim_shared_t;
+
+// Forks the server; port_name gets the pty to pass to sp_open(). Returns the child pid or -1
+pid_t sdo_sim_start(const sdo_sim_cfg_t *cfg, char *port_name, size_t port_name_size);
+void sdo_sim_stop(pid_t pid);
+sdo_sim_shared_t *sdo_sim_shared(void);
+#endif
+
+#endif // SDO_SIM_H__
@@ -2,160 +2,91 @@
 #include "CO_driver_target.h"
 #include <stdio.h>
 #include <stdlib.h>
-
-extern int CO_rx(void *priv, can_msg_t *msg);
-
-#define SLCAN_MAX_FRAME_SIZE (40 + 1)
-
-static uint8_t nibble2hex(uint8_t x) { return (x & 0x0F) > 9 ? (x & 0x0F) - 10 + 'A' : (x & 0x0F) + '0'; }
-static uint8_t hex2nibble(char c, bool *e)
-{
-	if(c >= '0' && c <= '9')
-		return c - '0';
-	else if(c >= 'a' && c <= 'f')
-		return c - 'a' + 10;
-	else if(c >= 'A' && c <= 'F')
-		return c - 'A' + 10;
-	*e = true;
-	return 0;
-}
-
-static int cb_frm_data_ext(const uint8_t *cmd, void *priv)
+#include <string.h>
+
+static const uint8_t hex_chr[16] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'};
+#define nibble2hex(x) hex_chr[(x) & 0x0F]
+
+#define HEX_INV 0x10 // hex_lut[] marker of a non hex character, OR-ed over a frame and checked once
+
+static const uint8_t hex_lut[256] = {
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+};
+
+static int decode(const uint8_t *cmd, size_t len, can_msg_t *msg)
 {
-	can_msg_t msg = {.IDE = 1, .RTR = 0};
-	bool e = false;
-	msg.id.ext = (hex2nibble(cmd[1], &e) << 28) | (hex2nibble(cmd[2], &e) << 24) | (hex2nibble(cmd[3], &e) << 20) | (hex2nibble(cmd[4], &e) << 16) |
-				 (hex2nibble(cmd[5], &e) << 12) | (hex2nibble(cmd[6], &e) << 8) | (hex2nibble(cmd[7], &e) << 4) | (hex2nibble(cmd[8], &e) << 0);
-	msg.DLC = hex2nibble(cmd[9], &e);
-	if(e || msg.DLC > 8) return -1;
-
-	const uint8_t *p = &cmd[10];
-	for(unsigned i = 0; i < msg.DLC; i++)
+	uint32_t id_len;
+	switch(cmd[0])
 	{
-		msg.data[i] = (hex2nibble(*p, &e) << 4) | hex2nibble(*(p + 1), &e);
-		p += 2;
+	case 't': *msg = (can_msg_t){.IDE = 0, .RTR = 0}, id_len = 3; break;
+	case 'T': *msg = (can_msg_t){.IDE = 1, .RTR = 0}, id_len = 8; break;
+	case 'r': *msg = (can_msg_t){.IDE = 0, .RTR = 1}, id_len = 3; break;
+	case 'R': *msg = (can_msg_t){.IDE = 1, .RTR = 1}, id_len = 8; break;
+	default: return -1; // commands and responses (s, S, O, L, l, C, M, m, Z, D, F, ...) are not handled
 	}
-	if(e) return -3;
-	return CO_rx(priv, &msg);
-}
+	if(len < 2 + id_len) return -1;
 
-static int cb_frm_data_std(const uint8_t *cmd, void *priv)
-{
-	can_msg_t msg = {.IDE = 0, .RTR = 0};
-	bool e = false;
-	msg.id.std = (hex2nibble(cmd[1], &e) << 8) | (hex2nibble(cmd[2], &e) << 4) | (hex2nibble(cmd[3], &e) << 0);
-	if(cmd[4] < '0' || cmd[4] > '0' + 8) return -1;
-	msg.DLC = cmd[4] - '0';
-	if(msg.DLC > 8) return -2;
-	const uint8_t *p = &cmd[5];
-	for(unsigned i = 0; i < msg.DLC; i++)
+	uint8_t chk = 0;
+	uint32_t id = 0;
+	for(uint32_t i = 1; i <= id_len; i++)
 	{
-		msg.data[i] = (hex2nibble(*p, &e) << 4) | hex2nibble(*(p + 1), &e);
-		p += 2;
+		chk |= hex_lut[cmd[i]];
+		id = (id << 4) | hex_lut[cmd[i]];
 	}
-	if(e) return -3;
-	return CO_rx(priv, &msg);
-}
-
-static int cb_frm_rtr_ext(const uint8_t *cmd, void *priv)
-{
-	can_msg_t msg = {.IDE = 1, .RTR = 1};
-	bool e = false;
-	msg.id.ext = (hex2nibble(cmd[1], &e) << 28) | (hex2nibble(cmd[2], &e) << 24) | (hex2nibble(cmd[3], &e) << 20) | (hex2nibble(cmd[4], &e) << 16) |
-				 (hex2nibble(cmd[5], &e) << 12) | (hex2nibble(cmd[6], &e) << 8) | (hex2nibble(cmd[7], &e) << 4) | (hex2nibble(cmd[8], &e) << 0);
-	if(cmd[9] < '0' || cmd[9] > '0' + 8) return -1;
-	msg.DLC = cmd[9] - '0';
-	if(msg.DLC > 8) return -2;
-	if(e) return -3;
-	return CO_rx(priv, &msg);
-}
-
-static int cb_frm_rtr_std(const uint8_t *cmd, void *priv)
-{
-	can_msg_t msg = {.IDE = 0, .RTR = 1};
-	bool e = false;
-	msg.id.std = (hex2nibble(cmd[1], &e) << 8) | (hex2nibble(cmd[2], &e) << 4) | (hex2nibble(cmd[3], &e) << 0);
-	if(cmd[4] < '0' || cmd[4] > '0' + 8) return -1;
-	msg.DLC = cmd[4] - '0';
-	if(msg.DLC > 8) return -2;
-	if(e) return -3;
-	return CO_rx(priv, &msg);
-}
-
-static int process(void *priv, const uint8_t *msg, uint32_t len)
-{
-	switch(msg[0])
+	const uint8_t dlc = hex_lut[cmd[1 + id_len]];
+	if((chk | dlc) & HEX_INV) return -1;
+	if(dlc > 8) return -2;
+	msg->id.ext = id;
+	msg->DLC = dlc;
+	if(msg->RTR) return 0;
+
+	if(len < 2 + id_len + 2U * dlc) return -1;
+	const uint8_t *p = &cmd[2 + id_len];
+	for(uint32_t i = 0; i < dlc; i++, p += 2)
 	{
-	case 'T': return cb_frm_data_ext(msg, priv);
-	case 't': return cb_frm_data_std(msg, priv);
-	case 'R': return cb_frm_rtr_ext(msg, priv);
-	case 'r':
-		if(msg[1] <= '9') return cb_frm_rtr_std(msg, priv);
-		return -1;
-
-	case 's': // Set CAN bitrate
-	case 'S': // Set CAN bitrate
-	case 'O': // Open CAN in normal mode
-	case 'L': // Open CAN in silent mode
-	case 'l': // Open CAN with loopback enabled
-	case 'C': // Close CAN
-	case 'M': // Set CAN acceptance filter ID
-	case 'm': // Set CAN acceptance filter mask
-	case 'Z': // Enable/disable RX and loopback timestamping
-	case 'D': // Tx CAN FD
-	case 'F': // Get status flags
-	default:
-		return -1;
-
-	case '\a':
-	case '\r':
-		if(len > 1) return slcan_parse(priv, msg + 1, len - 1);
-		return -1;
+		chk |= hex_lut[p[0]] | hex_lut[p[1]];
+		msg->data[i] = (uint8_t)(hex_lut[p[0]] << 4) | hex_lut[p[1]];
 	}
+	return (chk & HEX_INV) ? -3 : 0;
 }
 
-int slcan_parse(void *priv, const uint8_t *msg, int len)
+size_t slcan_parse(void *priv, const uint8_t *msg, size_t len)
 {
-	int resp = 0;
-	CO_CANmodule_t *m = (CO_CANmodule_t *)priv;
+	bool queued = false;
+	const uint8_t *p = msg, *end = msg + len, *cr;
 
-	for(int i = 0; i < len; i++)
+	while((cr = memchr(p, '\r', (size_t)(end - p))) != NULL) // whole commands are decoded in place
 	{
-		if(msg[i] >= 32 && msg[i] <= 126)
-		{
-			if(m->slcan.pos < SLCAN_BUFFER_SIZE)
-			{
-				m->slcan.buf[m->slcan.pos] = msg[i];
-				m->slcan.pos++;
-			}
-			else
-			{
-				m->slcan.pos = 0; // Buffer overrun; silently drop the data
-			}
-		}
-		else if(msg[i] == '\r') // End of command (SLCAN)
-		{
-			m->slcan.buf[m->slcan.pos] = '\0';
-			resp = process(priv, m->slcan.buf, m->slcan.pos);
-			m->slcan.pos = 0;
-		}
-		else if(msg[i] == 8 || msg[i] == 127) // DEL or BS
-		{
-			if(m->slcan.pos > 0) m->slcan.pos -= 1;
-		}
-		else
-		{
-			m->slcan.pos = 0; // Invalid byte - drop the current command, this also includes Ctrl+C, Ctrl+D
-		}
+		while(p < cr && (*p < 32 || *p > 126)) // leading control bytes, e.g. BELL error response
+			p++;
+		can_msg_t frame;
+		if(p < cr && cr - p <= SLCAN_BUFFER_SIZE && decode(p, (size_t)(cr - p), &frame) == 0 && CO_rx(priv, &frame) == 0) queued = true;
+		p = cr + 1;
 	}
+	if(queued) CO_CANmodule_wakeup((CO_CANmodule_t *)priv); // one wakeup per received chunk
 
-	return resp;
+	if(end - p > SLCAN_BUFFER_SIZE) return len; // overrun, silently drop the data
+	return (size_t)(p - msg);					// unterminated command stays in the rx ring
 }
 
-int slcan_tx(sp_t *sp, const can_msg_t *msg)
+int slcan_encode(const can_msg_t *msg, uint8_t *buf)
 {
-	uint8_t data[SLCAN_MAX_FRAME_SIZE];
-	uint8_t *p = data;
+	uint8_t *p = buf;
 	if(msg->RTR)
 	{
 		*p++ = msg->IDE ? 'R' : 'r';
@@ -196,5 +127,46 @@ int slcan_tx(sp_t *sp, const can_msg_t *msg)
 	*p++ = nibble2hex(msg->ts >> 0);
 	*p++ = '\r';
 
-	return sp_write(sp, data, p - data);
-}
\ No newline at end of file
+	return p - buf;
+}
+
+size_t slcan_encode_batch(const can_msg_t *msg, size_t cnt, uint8_t *buf)
+{
+	uint8_t *p = buf;
+	for(size_t i = 0; i < cnt; i++)
+		p += slcan_encode(&msg[i], p);
+	return (size_t)(p - buf);
+}
+
+int slcan_tx(sp_t *sp, const can_msg_t *msg)
+{
+	uint8_t data[SLCAN_MAX_FRAME_SIZE];
+	return sp_write(sp, data, slcan_encode(msg, data));
+}
+
+/* CO_CANmodule_t transport: the whole batch is encoded into the stage buffer and written with one syscall, the unwritten tail stays staged */
+static int slcan_drv_stage_write(CO_CANmodule_t *CANmodule)
+{
+	size_t written = 0;
+	sp_iovec_t iov = {.iov_base = CANmodule->tx.stage, .iov_len = CANmodule->tx.stage_len};
+	int sts = sp_writev((sp_t *)CANmodule->CANptr, &iov, 1, &written);
+	if(sts) written = CANmodule->tx.stage_len; // port error, drop
+	CANmodule->tx.stage_len -= written;
+	memmove(CANmodule->tx.stage, &CANmodule->tx.stage[written], CANmodule->tx.stage_len);
+	return sts;
+}
+
+static bool slcan_drv_tx_pending(CO_CANmodule_t *CANmodule)
+{
+	if(CANmodule->tx.stage_len) slcan_drv_stage_write(CANmodule);
+	return CANmodule->tx.stage_len != 0;
+}
+
+static int slcan_drv_tx(CO_CANmodule_t *CANmodule, const can_msg_t *msg, size_t cnt)
+{
+	CANmodule->tx.stage_len = (uint16_t)slcan_encode_batch(msg, cnt, CANmodule->tx.stage);
+	if(slcan_drv_stage_write(CANmodule)) return -1;
+	return CANmodule->tx.stage_len;
+}
+
+const CO_CANdrv_t CO_CANdrv_slcan = {.tx_pending = slcan_drv_tx_pending, .tx = slcan_drv_tx, .rx_filter = NULL};
@@ -5,6 +5,8 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#define SLCAN_MAX_FRAME_SIZE (40 + 1)
+
 typedef struct __attribute__((packed))
 {
 	union
@@ -19,7 +21,9 @@ typedef struct __attribute__((packed))
 	uint16_t ts;
 } can_msg_t;
 
-int slcan_parse(void *priv, const uint8_t *msg, int len);
+size_t slcan_parse(void *priv, const uint8_t *msg, size_t len); // returns bytes consumed, an unterminated command is left for the next call
+int slcan_encode(const can_msg_t *msg, uint8_t *buf); // buf must hold SLCAN_MAX_FRAME_SIZE, returns frame length
+size_t slcan_encode_batch(const can_msg_t *msg, size_t cnt, uint8_t *buf); // buf must hold cnt * SLCAN_MAX_FRAME_SIZE, returns total length
 int slcan_tx(sp_t *sp, const can_msg_t *msg);
 
 void cb_co_frame_rx(void *priv, can_msg_t *msg);
@@ -0,0 +1,258 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // recvmmsg, sendmmsg
+#endif
+#include "socketcan.h"
+
+#if defined(__linux__)
+#include "CO_driver_target.h"
+#include <errno.h>
+#include <linux/can.h>
+#include <linux/can/raw.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+_Static_assert(SOCKETCAN_TX_BATCH >= CO_CAN_TX_BATCH, "flush batch must fit into socketcan_t.tx");
+
+static void frame2msg(const struct can_frame *frm, can_msg_t *msg)
+{
+	*msg = (can_msg_t){.IDE = (frm->can_id & CAN_EFF_FLAG) != 0, .RTR = (frm->can_id & CAN_RTR_FLAG) != 0, .DLC = frm->can_dlc > 8 ? 8 : frm->can_dlc};
+	msg->id.ext = frm->can_id & (msg->IDE ? CAN_EFF_MASK : CAN_SFF_MASK);
+	memcpy(msg->data, frm->data, msg->DLC);
+}
+
+static void msg2frame(const can_msg_t *msg, struct can_frame *frm)
+{
+	memset(frm, 0, sizeof(*frm));
+	frm->can_id = msg->IDE ? ((msg->id.ext & CAN_EFF_MASK) | CAN_EFF_FLAG) : (msg->id.std & CAN_SFF_MASK);
+	if(msg->RTR) frm->can_id |= CAN_RTR_FLAG;
+	frm->can_dlc = msg->DLC;
+	memcpy(frm->data, msg->data, msg->DLC);
+}
+
+static void socketcan_drv_rx_filter(CO_CANmodule_t *CANmodule);
+
+static void *thr_rcv(void *arg)
+{
+	socketcan_t *can = (socketcan_t *)arg;
+	struct can_frame frm[SOCKETCAN_RX_BATCH];
+	struct iovec iov[SOCKETCAN_RX_BATCH];
+	struct mmsghdr mm[SOCKETCAN_RX_BATCH];
+	uint8_t ctrl[SOCKETCAN_RX_BATCH][CMSG_SPACE(sizeof(struct timespec))];
+	memset(mm, 0, sizeof(mm));
+	for(int i = 0; i < SOCKETCAN_RX_BATCH; i++)
+	{
+		iov[i] = (struct iovec){.iov_base = &frm[i], .iov_len = sizeof(frm[i])};
+		mm[i].msg_hdr.msg_iov = &iov[i];
+		mm[i].msg_hdr.msg_iovlen = 1;
+		mm[i].msg_hdr.msg_control = ctrl[i];
+	}
+
+	struct pollfd pfd[2] = {{.fd = can->fd, .events = POLLIN}, {.fd = can->evfd, .events = POLLIN}};
+	while(can->thr_run)
+	{
+		if(poll(pfd, 2, -1) < 0)
+		{
+			if(errno == EINTR) continue;
+			can->thr_error = SOCKETCAN_ERR_READ;
+			break;
+		}
+		if(pfd[1].revents) break; // socketcan_close()
+		if(!(pfd[0].revents & POLLIN))
+		{
+			if(!(pfd[0].revents & (POLLERR | POLLHUP | POLLNVAL))) continue;
+			can->thr_error = SOCKETCAN_ERR_READ;
+			break;
+		}
+
+		for(int i = 0; i < SOCKETCAN_RX_BATCH; i++)
+			mm[i].msg_hdr.msg_controllen = sizeof(ctrl[i]);
+		int n = recvmmsg(can->fd, mm, SOCKETCAN_RX_BATCH, MSG_DONTWAIT, NULL);
+		if(n < 0)
+		{
+			if(errno == EAGAIN || errno == EINTR) continue;
+			can->thr_error = SOCKETCAN_ERR_READ;
+			break;
+		}
+
+		bool queued = false;
+		for(int i = 0; i < n; i++)
+		{
+			if(mm[i].msg_len < sizeof(struct can_frame) || (frm[i].can_id & CAN_ERR_FLAG)) continue;
+			can_msg_t msg;
+			frame2msg(&frm[i], &msg);
+			for(struct cmsghdr *c = CMSG_FIRSTHDR(&mm[i].msg_hdr); c; c = CMSG_NXTHDR(&mm[i].msg_hdr, c))
+			{
+				if(c->cmsg_level == SOL_SOCKET && c->cmsg_type == SCM_TIMESTAMPNS)
+				{
+					struct timespec ts;
+					memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+					msg.ts = (uint16_t)((ts.tv_sec % 60) * 1000 + ts.tv_nsec / 1000000); // same range as SLCAN timestamp
+				}
+			}
+			if(CO_rx(can->priv, &msg) == 0) queued = true;
+		}
+		if(queued) CO_CANmodule_wakeup((CO_CANmodule_t *)can->priv); // one wakeup per batch
+	}
+	return 0;
+}
+
+int socketcan_open(socketcan_t *can, const char *ifname, void *priv)
+{
+	can->priv = priv;
+	can->tx.cnt = 0;
+	can->thr_error = 0;
+	can->thr_run = false;
+	can->fd = can->evfd = -1;
+	if(ifname) snprintf(can->ifname, sizeof(can->ifname), "%s", ifname);
+
+	int err = 0;
+	can->fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW);
+	if(can->fd < 0) return SOCKETCAN_ERR_SOCKET;
+
+	struct ifreq ifr = {0};
+	snprintf(ifr.ifr_name, sizeof(ifr.ifr_name), "%s", can->ifname);
+	if(ioctl(can->fd, SIOCGIFINDEX, &ifr) < 0)
+	{
+		err = SOCKETCAN_ERR_IFINDEX;
+		goto FAIL;
+	}
+
+	const int on = 1;
+	setsockopt(can->fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+
+	struct sockaddr_can addr = {.can_family = AF_CAN, .can_ifindex = ifr.ifr_ifindex};
+	if(bind(can->fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+	{
+		err = SOCKETCAN_ERR_BIND;
+		goto FAIL;
+	}
+	// rx buffers set up before the port was opened: CO_CANsetNormalMode() found no socket yet
+	if(priv && ((CO_CANmodule_t *)priv)->CANnormal) socketcan_drv_rx_filter((CO_CANmodule_t *)priv);
+
+	can->evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if(can->evfd < 0)
+	{
+		err = SOCKETCAN_ERR_CREATE_THREAD;
+		goto FAIL;
+	}
+	can->thr_run = true;
+	if(pthread_create(&can->thr_rcv, NULL, thr_rcv, can))
+	{
+		can->thr_run = false;
+		err = SOCKETCAN_ERR_CREATE_THREAD;
+		goto FAIL;
+	}
+	return 0;
+
+FAIL:
+	socketcan_close(can);
+	return err;
+}
+
+void socketcan_close(socketcan_t *can)
+{
+	if(can->thr_run)
+	{
+		can->thr_run = false;
+		uint64_t v = 1;
+		if(write(can->evfd, &v, sizeof(v)) < 0) {}
+		pthread_join(can->thr_rcv, NULL);
+	}
+	if(can->thr_error) printf("[SOCKETCAN] thread error: %d\n", can->thr_error);
+	if(can->evfd >= 0) close(can->evfd);
+	if(can->fd >= 0) close(can->fd);
+	can->evfd = can->fd = -1;
+}
+
+int socketcan_send(socketcan_t *can, const can_msg_t *msg, size_t cnt, size_t *sent)
+{
+	struct can_frame frm[SOCKETCAN_TX_BATCH];
+	struct iovec iov[SOCKETCAN_TX_BATCH];
+	struct mmsghdr mm[SOCKETCAN_TX_BATCH];
+
+	*sent = 0;
+	while(*sent < cnt)
+	{
+		const size_t n = cnt - *sent < SOCKETCAN_TX_BATCH ? cnt - *sent : SOCKETCAN_TX_BATCH;
+		memset(mm, 0, n * sizeof(mm[0]));
+		for(size_t i = 0; i < n; i++)
+		{
+			msg2frame(&msg[*sent + i], &frm[i]);
+			iov[i] = (struct iovec){.iov_base = &frm[i], .iov_len = sizeof(frm[i])};
+			mm[i].msg_hdr.msg_iov = &iov[i];
+			mm[i].msg_hdr.msg_iovlen = 1;
+		}
+		int r = sendmmsg(can->fd, mm, (unsigned)n, MSG_DONTWAIT);
+		if(r < 0)
+		{
+			if(errno == EAGAIN || errno == ENOBUFS || errno == EINTR) return 0; // tx queue full, retry later
+			return SOCKETCAN_ERR_WR;
+		}
+		*sent += (size_t)r;
+		if((size_t)r < n) break;
+	}
+	return 0;
+}
+
+/* CO_CANmodule_t transport: frames the socket didn't accept are kept in socketcan_t.tx */
+static bool socketcan_drv_tx_pending(CO_CANmodule_t *CANmodule)
+{
+	socketcan_t *can = (socketcan_t *)CANmodule->CANptr;
+	if(can->tx.cnt)
+	{
+		size_t sent = 0;
+		if(socketcan_send(can, can->tx.msg, can->tx.cnt, &sent)) sent = can->tx.cnt; // port error, drop
+		can->tx.cnt -= sent;
+		memmove(can->tx.msg, &can->tx.msg[sent], can->tx.cnt * sizeof(can->tx.msg[0]));
+	}
+	return can->tx.cnt != 0;
+}
+
+static int socketcan_drv_tx(CO_CANmodule_t *CANmodule, const can_msg_t *msg, size_t cnt)
+{
+	socketcan_t *can = (socketcan_t *)CANmodule->CANptr;
+	size_t sent = 0;
+	if(socketcan_send(can, msg, cnt, &sent)) return -1;
+	can->tx.cnt = cnt - sent;
+	memcpy(can->tx.msg, &msg[sent], can->tx.cnt * sizeof(can->tx.msg[0]));
+	return (int)can->tx.cnt;
+}
+
+/* Kernel acceptance filters from rxArray, frames nobody listens to never leave the kernel.
+ * With CO_FRAME_RX_CB the frame monitor sees the accepted frames only, unless socketcan_t.rx_all is set. */
+static void socketcan_drv_rx_filter(CO_CANmodule_t *CANmodule)
+{
+	socketcan_t *can = (socketcan_t *)CANmodule->CANptr;
+	if(can->fd < 0) return; // not open yet, socketcan_open() installs them
+	struct can_filter flt[CAN_RAW_FILTER_MAX];
+	size_t n = 0;
+	bool all = can->rx_all;
+	for(uint16_t i = 0U; i < CANmodule->rxSize && !all; i++)
+	{
+		const CO_CANrx_t *buffer = &CANmodule->rxArray[i];
+		if(buffer->CANrx_callback == NULL) continue;
+		if(n == CAN_RAW_FILTER_MAX) // too many, accept all and let rx_lut sort it out
+		{
+			all = true;
+			break;
+		}
+		flt[n].can_id = (buffer->ident & CAN_SFF_MASK) | ((buffer->ident & 0x0800U) ? CAN_RTR_FLAG : 0U);
+		flt[n].can_mask = (buffer->mask & CAN_SFF_MASK) | CAN_EFF_FLAG | CAN_RTR_FLAG;
+		n++;
+	}
+	if(all)
+	{
+		n = 1;
+		flt[0] = (struct can_filter){.can_id = 0, .can_mask = 0};
+	}
+	setsockopt(can->fd, SOL_CAN_RAW, CAN_RAW_FILTER, n ? flt : NULL, (socklen_t)(n * sizeof(flt[0])));
+}
+
+const CO_CANdrv_t CO_CANdrv_socketcan = {.tx_pending = socketcan_drv_tx_pending, .tx = socketcan_drv_tx, .rx_filter = socketcan_drv_rx_filter};
+#endif
@@ -0,0 +1,51 @@
+#ifndef SOCKETCAN_H__
+#define SOCKETCAN_H__
+
+#include "slcan.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__linux__)
+#include <net/if.h>
+#include <pthread.h>
+
+#define SOCKETCAN_RX_BATCH 32 // frames per recvmmsg()
+#define SOCKETCAN_TX_BATCH 32 // frames per sendmmsg(), at least CO_CAN_TX_BATCH
+
+enum
+{
+	SOCKETCAN_ERR_SOCKET = 1,
+	SOCKETCAN_ERR_IFINDEX,
+	SOCKETCAN_ERR_BIND,
+	SOCKETCAN_ERR_CREATE_THREAD,
+	SOCKETCAN_ERR_WR,
+	SOCKETCAN_ERR_READ,
+};
+
+typedef struct
+{
+	char ifname[IFNAMSIZ];
+	int fd;
+	int evfd;	 // stops the reader thread
+	bool rx_all; // no kernel filters: a CO_FRAME_RX_CB monitor sees the whole bus
+	pthread_t thr_rcv;
+	volatile bool thr_run;
+	int thr_error;
+	void *priv; // CO_CANmodule_t, frames are passed to CO_rx()
+	struct
+	{
+		can_msg_t msg[SOCKETCAN_TX_BATCH]; // not accepted by the socket yet
+		size_t cnt;
+	} tx;
+} socketcan_t;
+
+#define SOCKETCAN_INIT {.fd = -1, .evfd = -1} // socketcan_close() and the rx filters leave a port that was never opened alone
+
+int socketcan_open(socketcan_t *can, const char *ifname, void *priv);
+void socketcan_close(socketcan_t *can);
+// Non-blocking batch send: *sent is less than cnt if the socket queue is full
+int socketcan_send(socketcan_t *can, const can_msg_t *msg, size_t cnt, size_t *sent);
+
+#endif
+
+#endif // SOCKETCAN_H__
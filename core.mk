@@ -31,6 +31,7 @@
 # 	VERBOSE=yes
 #	.prebuild:
 #	$(SOURCES): dependencies
+#	OD_XDD = ../canopennode_driver/profile.xdd	(make od: OD.c/OD.h next to it, OD_GEN_FLAGS=-n without the direct index)
 #######################################
 
 #######################################
@@ -259,6 +260,19 @@ sys-info:
 list-targets:
 	@LC_ALL=C $(MAKE) -pRrq -f $(firstword $(MAKEFILE_LIST)) : 2>/dev/null | awk -v RS= -F: '/(^|\n)# Files(\n|$$)/,/(^|\n)# Finished Make data base/ {if ($$1 !~ "^[#.]") {print $$1}}' | sort | grep -E -v -e '^[^[:alnum:]]' -e '^$@$$'
 
+#######################################
+# object dictionary sources from the CANopenEditor project
+#######################################
+ifneq ($(OD_XDD),)
+OD_GEN_DIR ?= ../od_gen
+
+.PHONY: od
+od:
+	$(Q)$(MAKE) -C $(OD_GEN_DIR)
+	$(VECHO) ' [$(CLGRN)OD$(CLRST)]  $(OD_XDD) ...\n'
+	$(Q)$(OD_GEN_DIR)/build/od_gen $(OD_GEN_FLAGS) $(OD_XDD)
+endif
+
 ifneq ($(FOREIGN_MAKE_TARGETS),)
 clean: clean_foreign_targets
 endif
@@ -0,0 +1,660 @@
+#include "emit.h"
+#include <ctype.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SECTION(b, title)                                                                                                     \
+	bp(b, "/*******************************************************************************\n    %s\n"                        \
+		  "*******************************************************************************/\n",                              \
+	   title)
+
+typedef struct
+{
+	char *p;
+	size_t len, cap;
+	bool oom;
+} buf_t;
+
+__attribute__((format(printf, 2, 3))) static void bp(buf_t *b, const char *fmt, ...)
+{
+	va_list ap;
+	for(;;)
+	{
+		va_start(ap, fmt);
+		const int n = vsnprintf(b->p ? b->p + b->len : NULL, b->p ? b->cap - b->len : 0, fmt, ap);
+		va_end(ap);
+		if(n < 0 || b->oom)
+		{
+			b->oom = true;
+			return;
+		}
+		if(b->p && b->len + (size_t)n < b->cap)
+		{
+			b->len += (size_t)n;
+			return;
+		}
+		size_t cap = b->cap ? b->cap : 65536;
+		while(cap <= b->len + (size_t)n) cap *= 2;
+		char *p = realloc(b->p, cap);
+		if(!p)
+		{
+			b->oom = true;
+			return;
+		}
+		b->p = p;
+		b->cap = cap;
+	}
+}
+
+// Storage of one sub-object: strings and octet strings always, numbers with a default value, domains never
+static bool has_data(const xdd_sub_t *s)
+{
+	switch(s->type->kind)
+	{
+	case XDD_K_STR:
+	case XDD_K_OCTET: return true;
+	case XDD_K_DOMAIN: return false;
+	default: return s->def != NULL;
+	}
+}
+
+static bool arr_data(const xdd_obj_t *o)
+{
+	for(size_t i = 1; i < o->sub_cnt; i++)
+		if(has_data(&o->sub[i])) return true;
+	return false;
+}
+
+static size_t align_of(const xdd_sub_t *s) { return s->type->size ? s->type->size : 1; }
+
+static size_t rec_align(const xdd_obj_t *o)
+{
+	size_t a = 0;
+	for(size_t i = 0; i < o->sub_cnt; i++)
+		if(has_data(&o->sub[i]) && align_of(&o->sub[i]) > a) a = align_of(&o->sub[i]);
+	return a;
+}
+
+static const char *attr_str(const xdd_sub_t *s)
+{
+	static char out[64];
+	const char *sdo = (s->attr & XDD_SDO_R) && (s->attr & XDD_SDO_W) ? "ODA_SDO_RW"
+					  : (s->attr & XDD_SDO_R)						  ? "ODA_SDO_R"
+					  : (s->attr & XDD_SDO_W)						  ? "ODA_SDO_W"
+																	  : NULL;
+	const char *pdo = (s->attr & XDD_TPDO) && (s->attr & XDD_RPDO) ? "ODA_TRPDO"
+					  : (s->attr & XDD_TPDO)						 ? "ODA_TPDO"
+					  : (s->attr & XDD_RPDO)						 ? "ODA_RPDO"
+																	 : NULL;
+	const xdd_kind_t k = s->type->kind;
+	const char *mb = (k == XDD_K_UINT || k == XDD_K_INT || k == XDD_K_REAL) && s->type->size > 1 ? "ODA_MB" : NULL;
+	const char *str = k == XDD_K_STR ? "ODA_STR" : NULL;
+	const char *parts[] = {sdo, pdo, mb, str};
+	out[0] = 0;
+	for(size_t i = 0; i < sizeof(parts) / sizeof(parts[0]); i++)
+		if(parts[i])
+		{
+			if(out[0]) strcat(out, " | ");
+			strcat(out, parts[i]);
+		}
+	if(!out[0]) strcpy(out, "0");
+	return out;
+}
+
+// "0x600+$NODEID" is 0x600: the node-ID is added at runtime by the stack, like CANopenEditor does
+static bool number(const char *def, bool is_signed, long long *v)
+{
+	*v = 0;
+	const char *p = def;
+	for(;;)
+	{
+		while(isspace((unsigned char)*p)) p++;
+		if(!strncmp(p, "$NODEID", 7))
+			p += 7;
+		else
+		{
+			char *end;
+			*v += is_signed ? strtoll(p, &end, 0) : (long long)strtoull(p, &end, 0);
+			if(end == p) return false;
+			p = end;
+		}
+		while(isspace((unsigned char)*p)) p++;
+		if(!*p) return true;
+		if(*p++ != '+') return false;
+	}
+}
+
+// Initializer of a sub-object with storage, false if the default value doesn't parse
+static bool value(buf_t *b, const xdd_sub_t *s)
+{
+	const char *def = s->def ? s->def : "";
+	long long v;
+	switch(s->type->kind)
+	{
+	case XDD_K_STR:
+		bp(b, "{");
+		for(size_t i = 0; i <= s->len; i++)
+		{
+			const unsigned char c = i < strlen(def) ? (unsigned char)def[i] : 0;
+			if(c == '\'' || c == '\\')
+				bp(b, "%s'\\%c'", i ? ", " : "", c);
+			else if(c >= 0x20 && c < 0x7F)
+				bp(b, "%s'%c'", i ? ", " : "", c);
+			else
+				bp(b, "%s%u", i ? ", " : "", c);
+		}
+		bp(b, "}");
+		return true;
+	case XDD_K_OCTET:
+	{
+		bp(b, "{");
+		const char *p = def;
+		for(size_t i = 0; i < s->len; i++)
+		{
+			while(isspace((unsigned char)*p)) p++;
+			unsigned c = 0;
+			if(*p)
+			{
+				const char hex[3] = {p[0], p[1], 0};
+				c = (unsigned)strtoul(hex, NULL, 16);
+				p += 2;
+			}
+			bp(b, "%s0x%02X", i ? ", " : "", c);
+		}
+		bp(b, "}");
+		return true;
+	}
+	case XDD_K_REAL:
+	{
+		char *end;
+		(void)strtod(def, &end);
+		while(isspace((unsigned char)*end)) end++;
+		if(!*def || *end) return false;
+		bp(b, "%s", def);
+		return true;
+	}
+	case XDD_K_INT:
+		if(s->def && !number(def, true, &v)) return false;
+		bp(b, "%lld", s->def ? v : 0);
+		return true;
+	case XDD_K_BOOL:
+		if(!strcmp(def, "true") || !strcmp(def, "TRUE"))
+			v = 1;
+		else if(!strcmp(def, "false") || !strcmp(def, "FALSE") || !*def)
+			v = 0;
+		else if(!number(def, false, &v))
+			return false;
+		bp(b, "0x%02X", v ? 1 : 0);
+		return true;
+	default:
+		if(s->def && !number(def, false, &v)) return false;
+		if(!s->def) v = 0;
+		const unsigned long long u = s->type->size < 8 ? (unsigned long long)v & ((1ULL << (8 * s->type->size)) - 1) : (unsigned long long)v;
+		bp(b, "0x%0*llX", 2 * s->type->size, u);
+		return true;
+	}
+}
+
+// Declaration of a variable of a sub-object, name without array dimensions
+static void decl(buf_t *b, const char *indent, const xdd_sub_t *s, const char *name, const char *dim)
+{
+	if(s->type->kind == XDD_K_STR)
+		bp(b, "%schar %s%s[%zu];\n", indent, name, dim, s->len + 1);
+	else if(s->type->kind == XDD_K_OCTET)
+		bp(b, "%suint8_t %s%s[%zu];\n", indent, name, dim, s->len);
+	else
+		bp(b, "%s%s %s%s;\n", indent, s->type->ctype, name, dim);
+}
+
+// One member of a storage group: a VAR or REC object, the sub-index 0 or the elements of an ARR object
+typedef struct
+{
+	const xdd_obj_t *o;
+	bool elements;
+	size_t align;
+} member_t;
+
+typedef struct
+{
+	const xdd_t *x;
+	const emit_cfg_t *cfg;
+	const char **group; // in order of the first object with storage
+	size_t group_cnt;
+	member_t *m; // all groups, each ordered by alignment
+	size_t m_cnt;
+	char (*label)[32]; // count labels in order of appearance
+	size_t *label_cnt;
+	size_t labels;
+} gen_t;
+
+static int member_cmp(const void *a, const void *b)
+{
+	const member_t *ma = a, *mb = b;
+	if(ma->align != mb->align) return ma->align > mb->align ? -1 : 1;
+	if(ma->o->index != mb->o->index) return ma->o->index < mb->o->index ? -1 : 1;
+	return ma->elements - mb->elements; // stable: sub0 ahead of the elements
+}
+
+static int gen_init(gen_t *g)
+{
+	const xdd_t *x = g->x;
+	g->group = calloc(x->obj_cnt + 1, sizeof(*g->group));
+	g->m = calloc(2 * x->obj_cnt + 1, sizeof(*g->m));
+	g->label = calloc(x->obj_cnt + 1, sizeof(*g->label));
+	g->label_cnt = calloc(x->obj_cnt + 1, sizeof(*g->label_cnt));
+	if(!g->group || !g->m || !g->label || !g->label_cnt) return -1;
+	for(size_t i = 0; i < x->obj_cnt; i++)
+	{
+		const xdd_obj_t *o = &x->obj[i];
+		if(o->count_label)
+		{
+			size_t l = 0;
+			while(l < g->labels && strcmp(g->label[l], o->count_label)) l++;
+			if(l == g->labels) snprintf(g->label[g->labels++], sizeof(g->label[0]), "%s", o->count_label);
+			g->label_cnt[l]++;
+		}
+		const size_t m0 = g->m_cnt;
+		if(o->type == XDD_VAR && has_data(o->sub))
+			g->m[g->m_cnt++] = (member_t){o, false, align_of(o->sub)};
+		else if(o->type == XDD_REC && rec_align(o))
+			g->m[g->m_cnt++] = (member_t){o, false, rec_align(o)};
+		else if(o->type == XDD_ARR)
+		{
+			if(has_data(o->sub)) g->m[g->m_cnt++] = (member_t){o, false, 1};
+			if(arr_data(o)) g->m[g->m_cnt++] = (member_t){o, true, align_of(&o->sub[1])};
+		}
+		if(g->m_cnt == m0) continue;
+		size_t k = 0;
+		while(k < g->group_cnt && strcmp(g->group[k], o->group)) k++;
+		if(k == g->group_cnt) g->group[g->group_cnt++] = o->group;
+	}
+	qsort(g->m, g->m_cnt, sizeof(*g->m), member_cmp);
+	return 0;
+}
+
+static void gen_free(gen_t *g)
+{
+	free(g->group);
+	free(g->m);
+	free(g->label);
+	free(g->label_cnt);
+}
+
+static const xdd_obj_t *obj_find(const xdd_t *x, uint16_t index)
+{
+	for(size_t i = 0; i < x->obj_cnt; i++)
+		if(x->obj[i].index == index) return &x->obj[i];
+	return NULL;
+}
+
+static bool label_has(const gen_t *g, const char *label)
+{
+	for(size_t l = 0; l < g->labels; l++)
+		if(!strcmp(g->label[l], label)) return true;
+	return false;
+}
+
+// Record fields with storage, largest alignment first, then by sub-index
+static size_t rec_fields(const xdd_obj_t *o, const xdd_sub_t **f)
+{
+	size_t n = 0;
+	for(size_t a = 8; a; a /= 2)
+		for(size_t i = 0; i < o->sub_cnt; i++)
+			if(has_data(&o->sub[i]) && align_of(&o->sub[i]) == a) f[n++] = &o->sub[i];
+	return n;
+}
+
+static void header(buf_t *b, const gen_t *g, bool h)
+{
+	const xdd_t *x = g->x;
+	bp(b, "/*******************************************************************************\n"
+		  "    CANopen Object Dictionary definition for CANopenNode V4\n\n"
+		  "    This file was automatically generated by od_gen (make od) from the\n"
+		  "    CANopenEditor project\n\n"
+		  "    https://github.com/CANopenNode/CANopenNode\n"
+		  "    https://github.com/CANopenNode/CANopenEditor\n\n");
+	if(!h)
+	{
+		bp(b, "    DON'T EDIT THIS FILE MANUALLY, UNLESS YOU KNOW WHAT YOU ARE DOING !!!!\n"
+			  "*******************************************************************************/\n\n");
+		return;
+	}
+	bp(b, "    DON'T EDIT THIS FILE MANUALLY !!!!\n"
+		  "********************************************************************************\n\n");
+	bp(b, "    File info:\n        File Names:   OD.h; OD.c\n        Project File: %s\n        File Version: %s\n\n", g->cfg->project,
+	   x->file_version);
+	bp(b, "        Created:      %s\n        Created By:   %s\n        Modified:     %s\n        Modified By:  %s\n\n", x->created,
+	   x->created_by, x->modified, x->modified_by);
+	bp(b, "    Device Info:\n        Vendor Name:  %s\n        Vendor ID:    %s\n        Product Name: %s\n        Product ID:   %s\n\n",
+	   x->vendor_name, x->vendor_id, x->product_name, x->product_id);
+	bp(b, "        Description:  %s\n*******************************************************************************/\n\n", x->description);
+}
+
+// CO_config_t of CANopen.h as OD_INIT_CONFIG fills it: count labels, array sizes and entries
+static const struct
+{
+	char kind; // 'C' count label, 'A' array size, 'E' entry
+	const char *key;
+} config[] = {
+	{'C', "NMT"},	  {'E', "1017"},	{'C', "HB_CONS"}, {'A', "1016"},	{'E', "1016"},	  {'C', "EM"},		{'E', "1001"},
+	{'E', "1014"},	  {'E', "1015"},	{'A', "1003"},	  {'E', "1003"},	{'C', "SDO_SRV"}, {'E', "1200"},	{'C', "SDO_CLI"},
+	{'E', "1280"},	  {'C', "TIME"},	{'E', "1012"},	  {'C', "SYNC"},	{'E', "1005"},	  {'E', "1006"},	{'E', "1007"},
+	{'E', "1019"},	  {'C', "RPDO"},	{'E', "1400"},	  {'E', "1600"},	{'C', "TPDO"},	  {'E', "1800"},	{'E', "1A00"},
+	{'C', "LEDS"},	  {'C', "GFC"},		{'E', "1300"},	  {'C', "SRDO"},	{'E', "1301"},	  {'E', "1381"},	{'E', "13FE"},
+	{'E', "13FF"},	  {'C', "LSS_SLV"}, {'C', "LSS_MST"}, {'C', "GTWA"},	{'C', "TRACE"},
+};
+
+static void od_h(buf_t *b, const gen_t *g)
+{
+	const xdd_t *x = g->x;
+	header(b, g, true);
+	bp(b, "#ifndef OD_H\n#define OD_H\n");
+	SECTION(b, "Counters of OD objects");
+	for(size_t l = 0; l < g->labels; l++) bp(b, "#define OD_CNT_%s %zu\n", g->label[l], g->label_cnt[l]);
+	bp(b, "\n\n");
+	SECTION(b, "Sizes of OD arrays");
+	for(size_t i = 0; i < x->obj_cnt; i++)
+		if(x->obj[i].type == XDD_ARR) bp(b, "#define OD_CNT_ARR_%04X %zu\n", x->obj[i].index, x->obj[i].sub_cnt - 1);
+	bp(b, "\n\n");
+
+	SECTION(b, "OD data declaration of all groups");
+	for(size_t k = 0; k < g->group_cnt; k++)
+	{
+		bp(b, "typedef struct {\n");
+		for(size_t i = 0; i < g->m_cnt; i++)
+		{
+			const member_t *m = &g->m[i];
+			const xdd_obj_t *o = m->o;
+			if(strcmp(o->group, g->group[k])) continue;
+			char name[96], dim[32];
+			snprintf(name, sizeof(name), "x%04X_%s", o->index, o->cname);
+			if(o->type == XDD_VAR)
+				decl(b, "    ", o->sub, name, "");
+			else if(o->type == XDD_ARR && !m->elements)
+				bp(b, "    uint8_t %s_sub0;\n", name);
+			else if(o->type == XDD_ARR)
+			{
+				snprintf(dim, sizeof(dim), "[OD_CNT_ARR_%04X]", o->index);
+				decl(b, "    ", &o->sub[1], name, dim);
+			}
+			else
+			{
+				const xdd_sub_t *f[256];
+				const size_t n = rec_fields(o, f);
+				bp(b, "    struct {\n");
+				for(size_t j = 0; j < n; j++) decl(b, "        ", f[j], f[j]->cname, "");
+				bp(b, "    } %s;\n", name);
+			}
+		}
+		bp(b, "} OD_%s_t;\n\n", g->group[k]);
+	}
+	for(size_t k = 0; k < g->group_cnt; k++)
+		bp(b, "#ifndef OD_ATTR_%s\n#define OD_ATTR_%s\n#endif\nextern OD_ATTR_%s OD_%s_t OD_%s;\n\n", g->group[k], g->group[k], g->group[k],
+		   g->group[k], g->group[k]);
+	bp(b, "#ifndef OD_ATTR_OD\n#define OD_ATTR_OD\n#endif\nextern OD_ATTR_OD OD_t *OD;\n\n\n");
+
+	SECTION(b, "Object dictionary entries - shortcuts");
+	for(size_t i = 0; i < x->obj_cnt; i++) bp(b, "#define OD_ENTRY_H%04X &OD->list[%zu]\n", x->obj[i].index, i);
+	bp(b, "\n\n");
+	SECTION(b, "Object dictionary entries - shortcuts with names");
+	for(size_t i = 0; i < x->obj_cnt; i++) bp(b, "#define OD_ENTRY_H%04X_%s &OD->list[%zu]\n", x->obj[i].index, x->obj[i].cname, i);
+	bp(b, "\n\n");
+
+	SECTION(b, "OD config structure");
+	bp(b, "#ifdef CO_MULTIPLE_OD\n#define OD_INIT_CONFIG(config) {\\\n");
+	for(size_t i = 0; i < sizeof(config) / sizeof(config[0]); i++)
+	{
+		const char *key = config[i].key;
+		const xdd_obj_t *o = config[i].kind == 'C' ? NULL : obj_find(x, (uint16_t)strtoul(key, NULL, 16));
+		if(config[i].kind == 'C' && label_has(g, key))
+			bp(b, "    (config).CNT_%s = OD_CNT_%s;\\\n", key, key);
+		else if(config[i].kind == 'C')
+			bp(b, "    (config).CNT_%s = 0;\\\n", key);
+		else if(config[i].kind == 'A' && o && o->type == XDD_ARR)
+			bp(b, "    (config).CNT_ARR_%s = OD_CNT_ARR_%s;\\\n", key, key);
+		else if(config[i].kind == 'A')
+			bp(b, "    (config).CNT_ARR_%s = 0;\\\n", key);
+		else if(o)
+			bp(b, "    (config).ENTRY_H%s = OD_ENTRY_H%s;\\\n", key, key);
+		else
+			bp(b, "    (config).ENTRY_H%s = NULL;\\\n", key);
+	}
+	bp(b, "}\n#endif\n\n#endif /* OD_H */\n");
+}
+
+static int od_c_data(buf_t *b, const gen_t *g)
+{
+	SECTION(b, "OD data initialization of all groups");
+	for(size_t k = 0; k < g->group_cnt; k++)
+	{
+		bp(b, "%sOD_ATTR_%s OD_%s_t OD_%s = {\n", k ? "\n" : "", g->group[k], g->group[k], g->group[k]);
+		bool first = true;
+		for(size_t i = 0; i < g->m_cnt; i++)
+		{
+			const member_t *m = &g->m[i];
+			const xdd_obj_t *o = m->o;
+			if(strcmp(o->group, g->group[k])) continue;
+			bp(b, "%s    .x%04X_%s", first ? "" : ",\n", o->index, o->cname);
+			first = false;
+			const xdd_sub_t *bad = NULL;
+			if(o->type == XDD_VAR)
+			{
+				bp(b, " = ");
+				if(!value(b, o->sub)) bad = o->sub;
+			}
+			else if(o->type == XDD_ARR && !m->elements)
+			{
+				bp(b, "_sub0 = ");
+				if(!value(b, o->sub)) bad = o->sub;
+			}
+			else if(o->type == XDD_ARR)
+			{
+				bp(b, " = {");
+				for(size_t s = 1; s < o->sub_cnt && !bad; s++)
+				{
+					bp(b, "%s", s > 1 ? ", " : "");
+					if(!value(b, &o->sub[s])) bad = &o->sub[s];
+				}
+				bp(b, "}");
+			}
+			else
+			{
+				const xdd_sub_t *f[256];
+				const size_t n = rec_fields(o, f);
+				bp(b, " = {\n");
+				for(size_t j = 0; j < n && !bad; j++)
+				{
+					bp(b, "        .%s = ", f[j]->cname);
+					if(!value(b, f[j])) bad = f[j];
+					bp(b, "%s\n", j + 1 < n ? "," : "");
+				}
+				bp(b, "    }");
+			}
+			if(bad)
+			{
+				fprintf(stderr, "%04X sub %02X %s: default value \"%s\" not valid for %s\n", o->index, bad->sub, bad->name, bad->def ? bad->def : "",
+						bad->type->xdd);
+				return -1;
+			}
+		}
+		bp(b, "\n};\n");
+	}
+	bp(b, "\n\n\n");
+	return 0;
+}
+
+static void data_ref(buf_t *b, const char *field, const xdd_obj_t *o, const char *member, const char *tail)
+{
+	if(!member)
+		bp(b, "%s = NULL,\n", field);
+	else
+		bp(b, "%s = &OD_%s.x%04X_%s%s,\n", field, o->group, o->index, member, tail);
+}
+
+static void od_c_objs(buf_t *b, const gen_t *g)
+{
+	const xdd_t *x = g->x;
+	SECTION(b, "All OD objects (constant definitions)");
+	bp(b, "typedef struct {\n");
+	for(size_t i = 0; i < x->obj_cnt; i++)
+	{
+		const xdd_obj_t *o = &x->obj[i];
+		if(o->type == XDD_VAR)
+			bp(b, "    OD_obj_var_t o_%04X_%s;\n", o->index, o->cname);
+		else if(o->type == XDD_ARR)
+			bp(b, "    OD_obj_array_t o_%04X_%s;\n", o->index, o->cname);
+		else
+			bp(b, "    OD_obj_record_t o_%04X_%s[%zu];\n", o->index, o->cname, o->sub_cnt);
+	}
+	bp(b, "} ODObjs_t;\n\nstatic CO_PROGMEM ODObjs_t ODObjs = {\n");
+	for(size_t i = 0; i < x->obj_cnt; i++)
+	{
+		const xdd_obj_t *o = &x->obj[i];
+		const bool str = o->sub->type->kind == XDD_K_STR || o->sub->type->kind == XDD_K_OCTET;
+		bp(b, "    .o_%04X_%s = {\n", o->index, o->cname);
+		if(o->type == XDD_VAR)
+		{
+			data_ref(b, "        .dataOrig", o, has_data(o->sub) ? o->cname : NULL, str ? "[0]" : "");
+			bp(b, "        .attribute = %s,\n        .dataLength = %zu\n", attr_str(o->sub), o->sub->len);
+		}
+		else if(o->type == XDD_ARR)
+		{
+			char sub0[80];
+			snprintf(sub0, sizeof(sub0), "%s_sub0", o->cname);
+			const xdd_sub_t *e = &o->sub[1];
+			data_ref(b, "        .dataOrig0", o, has_data(o->sub) ? sub0 : NULL, "");
+			data_ref(b, "        .dataOrig", o, arr_data(o) ? o->cname : NULL, e->type->kind == XDD_K_STR || e->type->kind == XDD_K_OCTET ? "[0][0]" : "[0]");
+			bp(b, "        .attribute0 = %s,\n", attr_str(o->sub));
+			bp(b, "        .attribute = %s,\n        .dataElementLength = %zu,\n", attr_str(e), e->len);
+			if(e->type->kind == XDD_K_STR)
+				bp(b, "        .dataElementSizeof = %zu\n", e->len + 1);
+			else if(e->type->kind == XDD_K_OCTET)
+				bp(b, "        .dataElementSizeof = %zu\n", e->len);
+			else
+				bp(b, "        .dataElementSizeof = sizeof(%s)\n", e->type->ctype);
+		}
+		else
+			for(size_t s = 0; s < o->sub_cnt; s++)
+			{
+				const xdd_sub_t *f = &o->sub[s];
+				const bool fstr = f->type->kind == XDD_K_STR || f->type->kind == XDD_K_OCTET;
+				char member[160];
+				snprintf(member, sizeof(member), "%s.%s", o->cname, f->cname);
+				bp(b, "        {\n");
+				data_ref(b, "            .dataOrig", o, has_data(f) ? member : NULL, fstr ? "[0]" : "");
+				bp(b, "            .subIndex = %u,\n            .attribute = %s,\n            .dataLength = %zu\n", f->sub, attr_str(f), f->len);
+				bp(b, "        }%s\n", s + 1 < o->sub_cnt ? "," : "");
+			}
+		bp(b, "    }%s\n", i + 1 < x->obj_cnt ? "," : "");
+	}
+	bp(b, "};\n\n\n");
+}
+
+static void od_c_list(buf_t *b, const gen_t *g)
+{
+	const xdd_t *x = g->x;
+	static const char *odt[] = {[XDD_VAR] = "ODT_VAR", [XDD_ARR] = "ODT_ARR", [XDD_REC] = "ODT_REC"};
+	SECTION(b, "Object dictionary");
+	bp(b, "static OD_ATTR_OD OD_entry_t ODList[] = {\n");
+	for(size_t i = 0; i < x->obj_cnt; i++)
+	{
+		const xdd_obj_t *o = &x->obj[i];
+		bp(b, "    {0x%04X, 0x%02zX, %s, &ODObjs.o_%04X_%s, NULL},\n", o->index, o->sub_cnt, odt[o->type], o->index, o->cname);
+	}
+	bp(b, "    {0x0000, 0x00, 0, NULL, NULL}\n};\n\n");
+
+	if(g->cfg->lut)
+	{
+		bp(b, "\n");
+		SECTION(b, "Direct index for OD_find(): ODList position by index, 0xFFFF (OD_LUT_NONE)\n    if absent, one table per high byte of the index in use");
+		for(size_t i = 0; i < x->obj_cnt; i++)
+		{
+			const unsigned page = x->obj[i].index >> 8;
+			if(i && x->obj[i - 1].index >> 8 == page) continue;
+			bp(b, "static CO_PROGMEM uint16_t ODLut%02X[256] = {\n", page);
+			size_t j = i;
+			for(unsigned slot = 0; slot < 256; slot++)
+			{
+				unsigned v = 0xFFFF;
+				if(j < x->obj_cnt && x->obj[j].index == (page << 8 | slot)) v = (unsigned)j++;
+				bp(b, "%s0x%04X%s", slot % 16 ? " " : "    ", v, slot == 255 ? "\n" : slot % 16 == 15 ? ",\n" : ",");
+			}
+			bp(b, "};\n\n");
+		}
+		bp(b, "static CO_PROGMEM OD_lut_t ODLut = {\n    .page = {\n");
+		for(size_t i = 0; i < x->obj_cnt; i++)
+			if(!i || x->obj[i - 1].index >> 8 != x->obj[i].index >> 8) bp(b, "        [0x%02X] = ODLut%02X,\n", x->obj[i].index >> 8, x->obj[i].index >> 8);
+		bp(b, "    }\n};\n\n");
+	}
+	bp(b, "static OD_t _OD = {\n    (sizeof(ODList) / sizeof(ODList[0])) - 1,\n    &ODList[0],\n    %s\n};\n\nOD_t *OD = &_OD;\n",
+	   g->cfg->lut ? "&ODLut" : "NULL");
+}
+
+static int od_c(buf_t *b, const gen_t *g)
+{
+	header(b, g, false);
+	bp(b, "#define OD_DEFINITION\n#include \"301/CO_ODinterface.h\"\n#include \"OD.h\"\n\n"
+		  "#if CO_VERSION_MAJOR < 4\n#error This Object dictionary is compatible with CANopenNode V4.0 and above!\n#endif\n\n");
+	if(od_c_data(b, g)) return -1;
+	od_c_objs(b, g);
+	od_c_list(b, g);
+	return 0;
+}
+
+// Writes b to dir/name unless the file has this content already
+static int put(const buf_t *b, const char *dir, const char *name)
+{
+	char path[1024];
+	snprintf(path, sizeof(path), "%s%s%s", dir, *dir && dir[strlen(dir) - 1] != '/' ? "/" : "", name);
+	FILE *f = fopen(path, "rb");
+	if(f)
+	{
+		char *old = malloc(b->len + 1);
+		const bool same = old && fread(old, 1, b->len + 1, f) == b->len && !memcmp(old, b->p, b->len);
+		free(old);
+		fclose(f);
+		if(same) return 0;
+	}
+	f = fopen(path, "wb");
+	const bool ok = f && fwrite(b->p, 1, b->len, f) == b->len;
+	if(f && fclose(f)) return -1;
+	if(!ok)
+	{
+		fprintf(stderr, "%s: can't write\n", path);
+		return -1;
+	}
+	printf("%s\n", path);
+	return 0;
+}
+
+int emit_od(const xdd_t *xdd, const emit_cfg_t *cfg, const char *dir)
+{
+	gen_t g = {.x = xdd, .cfg = cfg};
+	buf_t h = {0}, c = {0};
+	int ret = -1;
+	for(size_t i = 0; i < xdd->obj_cnt; i++)
+		if(xdd->obj[i].type == XDD_ARR && xdd->obj[i].sub_cnt < 2)
+		{
+			fprintf(stderr, "%04X: array without elements\n", xdd->obj[i].index);
+			return -1;
+		}
+	if(gen_init(&g))
+		fprintf(stderr, "out of memory\n");
+	else
+	{
+		od_h(&h, &g);
+		if(!od_c(&c, &g))
+		{
+			if(h.oom || c.oom)
+				fprintf(stderr, "out of memory\n");
+			else
+				ret = put(&h, dir, "OD.h") || put(&c, dir, "OD.c") ? -1 : 0;
+		}
+	}
+	gen_free(&g);
+	free(h.p);
+	free(c.p);
+	return ret;
+}
@@ -0,0 +1,24 @@
+#ifndef EMIT_H__
+#define EMIT_H__
+
+#include "xdd.h"
+
+/**
+ * OD.h and OD.c for CANopenNode V4 in the layout of CANopenEditor, with:
+ * 	- objects sorted by index, sub-objects by sub-index (OD_find() and the OD_ENTRY_H* shortcuts rely on it)
+ * 	- members of the storage groups (OD_PERSIST_COMM_t, OD_RAM_t, ...) and of the record structs ordered by
+ * 	  alignment, largest first, so no padding is needed: the names stay, the layout of a stored group changes
+ * 	- ODObjs and the direct index in CO_PROGMEM (.rodata); ODList stays writable for OD_extension_init()
+ * 	- lut: the OD_lut_t direct index for OD_find(), else OD_t.lut is NULL and co_od_lut_init() builds it at runtime
+ */
+
+typedef struct
+{
+	const char *project; // project file name for the header comment
+	bool lut;
+} emit_cfg_t;
+
+// Writes dir/OD.h and dir/OD.c, files with the same content are left untouched. 0 or -1 with the reason on stderr
+int emit_od(const xdd_t *xdd, const emit_cfg_t *cfg, const char *dir);
+
+#endif // EMIT_H__
@@ -0,0 +1,46 @@
+// OD.c and OD.h for CANopenNode V4 from a CANopenEditor project (.xdd/.xpd), see emit.h
+// usage: program [-n] project.xdd [out_dir]
+//   -n      - no OD_lut_t direct index in the output
+//   out_dir - default: the directory of the project
+#include "emit.h"
+#include "xdd.h"
+#include <stdio.h>
+#include <string.h>
+
+int main(int argc, char *argv[])
+{
+	emit_cfg_t cfg = {.lut = true};
+	const char *in = NULL, *dir = NULL;
+	bool ok = true;
+	for(int i = 1; i < argc && ok; i++)
+	{
+		if(!strcmp(argv[i], "-n"))
+			cfg.lut = false;
+		else if(argv[i][0] != '-' && !in)
+			in = argv[i];
+		else if(argv[i][0] != '-' && !dir)
+			dir = argv[i];
+		else
+			ok = false;
+	}
+	if(!ok || !in)
+	{
+		fprintf(stderr, "Error! Wrong arguments!\nUsage: [-n] project.xdd [out_dir]\n"
+						"  project - CANopenEditor XDD or XPD with the CANopenNode properties\n"
+						"  out_dir - where OD.c and OD.h go, default: the directory of the project\n"
+						"  -n      - no direct index for OD_find() (smaller, binary search at runtime)\n");
+		return -1;
+	}
+
+	char in_dir[1024] = ".";
+	const char *slash = strrchr(in, '/'), *bslash = strrchr(in, '\\');
+	if(bslash > slash) slash = bslash;
+	if(slash) snprintf(in_dir, sizeof(in_dir), "%.*s", (int)(slash - in), in);
+	cfg.project = slash ? slash + 1 : in;
+
+	xdd_t xdd;
+	if(xdd_load(&xdd, in)) return -1;
+	const int ret = emit_od(&xdd, &cfg, dir ? dir : in_dir);
+	xdd_free(&xdd);
+	return ret;
+}
@@ -0,0 +1,397 @@
+#include "xdd.h"
+#include "xml.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const xdd_type_t types[] = {
+	{"BOOL", "bool_t", XDD_K_BOOL, 1},
+	{"SINT", "int8_t", XDD_K_INT, 1},
+	{"INT", "int16_t", XDD_K_INT, 2},
+	{"DINT", "int32_t", XDD_K_INT, 4},
+	{"LINT", "int64_t", XDD_K_INT, 8},
+	{"USINT", "uint8_t", XDD_K_UINT, 1},
+	{"UINT", "uint16_t", XDD_K_UINT, 2},
+	{"UDINT", "uint32_t", XDD_K_UINT, 4},
+	{"ULINT", "uint64_t", XDD_K_UINT, 8},
+	{"BYTE", "uint8_t", XDD_K_UINT, 1},
+	{"WORD", "uint16_t", XDD_K_UINT, 2},
+	{"DWORD", "uint32_t", XDD_K_UINT, 4},
+	{"LWORD", "uint64_t", XDD_K_UINT, 8},
+	{"REAL", "float32_t", XDD_K_REAL, 4},
+	{"LREAL", "float64_t", XDD_K_REAL, 8},
+	{"STRING", "char", XDD_K_STR, 0},
+	{"BITSTRING", "uint8_t", XDD_K_DOMAIN, 0}, // domain without a default value, octet string with one
+};
+static const xdd_type_t type_octet = {"BITSTRING", "uint8_t", XDD_K_OCTET, 0};
+
+typedef struct
+{
+	const char *uid;
+	const xml_node_t *n;
+} ref_t;
+
+typedef struct
+{
+	const char *path;
+	ref_t *uid;
+	size_t uid_cnt;
+} ctx_t;
+
+static int uid_cmp(const void *a, const void *b) { return strcmp(((const ref_t *)a)->uid, ((const ref_t *)b)->uid); }
+
+static const xml_node_t *param(const ctx_t *c, const char *uid)
+{
+	if(!uid) return NULL;
+	const ref_t key = {.uid = uid}, *f = bsearch(&key, c->uid, c->uid_cnt, sizeof(*c->uid), uid_cmp);
+	return f ? f->n : NULL;
+}
+
+static const char *property(const xml_node_t *p, const char *name)
+{
+	if(!p) return NULL;
+	for(size_t i = 0; i < p->child_cnt; i++)
+		if(!strcmp(p->child[i]->name, "property"))
+		{
+			const char *n = xml_attr(p->child[i], "name");
+			if(n && !strcmp(n, name)) return xml_attr(p->child[i], "value");
+		}
+	return NULL;
+}
+
+static char *dup(const char *s)
+{
+	char *d = malloc(strlen(s) + 1);
+	if(d) strcpy(d, s);
+	return d;
+}
+
+// C identifier as CANopenEditor makes it: "COB-ID SYNC message" -> COB_ID_SYNCMessage,
+// "Highest sub-index supported" -> highestSub_indexSupported, "Application object 1" -> applicationObject_1
+static void cname(char *out, size_t size, const char *name)
+{
+	size_t o = 0;
+	for(const char *p = name; *p && o + 2 < size;)
+	{
+		while(*p && !(isalnum((unsigned char)*p) || *p == '_' || *p == '-')) p++;
+		if(!*p) break;
+		const char first = *p;
+		if(o && ((isupper((unsigned char)out[o - 1]) && isupper((unsigned char)first)) || isdigit((unsigned char)first))) out[o++] = '_';
+		for(bool tok_first = true; (isalnum((unsigned char)*p) || *p == '_' || *p == '-') && o + 1 < size; p++, tok_first = false)
+			out[o++] = *p == '-' ? '_' : tok_first ? (char)toupper((unsigned char)*p) : *p;
+	}
+	out[o] = 0;
+	if(o && !(o > 1 && isupper((unsigned char)out[1]))) out[0] = (char)tolower((unsigned char)out[0]);
+}
+
+// Bytes of an octet string default "01 02 FF" or "0102FF", -1 if malformed
+static long octet_len(const char *def)
+{
+	long n = 0, digits = 0;
+	for(const char *p = def; *p; p++)
+	{
+		if(isxdigit((unsigned char)*p))
+			digits++;
+		else if(isspace((unsigned char)*p))
+		{
+			if(digits & 1) return -1;
+		}
+		else
+			return -1;
+		if(digits == 2)
+		{
+			n++;
+			digits = 0;
+		}
+	}
+	return digits ? -1 : n;
+}
+
+static uint8_t access_attr(const char *access)
+{
+	if(!access || !strcmp(access, "read") || !strcmp(access, "const")) return XDD_SDO_R;
+	if(!strcmp(access, "write")) return XDD_SDO_W;
+	if(!strcmp(access, "readWrite")) return XDD_SDO_R | XDD_SDO_W;
+	return 0; // noAccess
+}
+
+static uint8_t pdo_attr(const char *mapping, uint8_t sdo)
+{
+	if(!mapping || !strcmp(mapping, "no")) return 0;
+	if(!strcmp(mapping, "TPDO")) return XDD_TPDO;
+	if(!strcmp(mapping, "RPDO")) return XDD_RPDO;
+	return (uint8_t)(((sdo & XDD_SDO_R) ? XDD_TPDO : 0) | ((sdo & XDD_SDO_W) ? XDD_RPDO : 0)); // optional, default
+}
+
+// Sub-object from its parameter, obj is the parameter of the object for inherited properties
+static int sub_load(const ctx_t *c, xdd_sub_t *s, const char *name, const char *mapping, const xml_node_t *p, const xml_node_t *obj)
+{
+	s->name = dup(name);
+	if(!s->name) return -1;
+	cname(s->cname, sizeof(s->cname), name);
+	s->type = NULL;
+	for(size_t i = 0; i < p->child_cnt && !s->type; i++)
+		for(size_t t = 0; t < sizeof(types) / sizeof(types[0]); t++)
+			if(!strcmp(p->child[i]->name, types[t].xdd))
+			{
+				s->type = &types[t];
+				break;
+			}
+	if(!s->type)
+	{
+		fprintf(stderr, "%s:%d: %s: no supported data type\n", c->path, p->line, name);
+		return -1;
+	}
+	const uint8_t sdo = access_attr(xml_attr(p, "access"));
+	s->attr = (uint8_t)(sdo | pdo_attr(mapping, sdo));
+
+	const xml_node_t *d = xml_child(p, "defaultValue");
+	const char *def = d ? xml_attr(d, "value") : NULL;
+	if(def && *def && !(s->def = dup(def))) return -1;
+
+	const char *min = property(p, "CO_stringLengthMin");
+	if(!min) min = property(obj, "CO_stringLengthMin");
+	const size_t len_min = min ? (size_t)strtoul(min, NULL, 0) : 0;
+	s->len = s->type->size;
+	if(s->type->kind == XDD_K_STR)
+	{
+		s->len = s->def ? strlen(s->def) : 0;
+		if(s->len < len_min) s->len = len_min;
+	}
+	else if(s->type->kind == XDD_K_DOMAIN && s->def)
+	{
+		const long n = octet_len(s->def);
+		if(n < 0)
+		{
+			fprintf(stderr, "%s:%d: %s: octet string \"%s\" is not hex bytes\n", c->path, p->line, name, s->def);
+			return -1;
+		}
+		s->type = &type_octet;
+		s->len = (size_t)n < len_min ? len_min : (size_t)n;
+	}
+	return 0;
+}
+
+static int sub_cmp(const void *a, const void *b) { return ((const xdd_sub_t *)a)->sub - ((const xdd_sub_t *)b)->sub; }
+static int obj_cmp(const void *a, const void *b) { return ((const xdd_obj_t *)a)->index - ((const xdd_obj_t *)b)->index; }
+
+static int obj_load(const ctx_t *c, xdd_obj_t *o, const xml_node_t *n)
+{
+	const char *index = xml_attr(n, "index"), *type = xml_attr(n, "objectType"), *name = xml_attr(n, "name");
+	const xml_node_t *p = param(c, xml_attr(n, "uniqueIDRef"));
+	char *end;
+	const unsigned long idx = index ? strtoul(index, &end, 16) : 0;
+	if(!index || *end || !idx || idx > 0xFFFF || !type || !name || !p)
+	{
+		fprintf(stderr, "%s:%d: incomplete CANopenObject\n", c->path, n->line);
+		return -1;
+	}
+	o->index = (uint16_t)idx;
+	o->type = (uint8_t)atoi(type);
+	if(!(o->name = dup(name)) || !(o->group = dup(property(p, "CO_storageGroup") ? property(p, "CO_storageGroup") : "RAM"))) return -1;
+	cname(o->cname, sizeof(o->cname), name);
+	const char *label = property(p, "CO_countLabel");
+	if(label && *label && !(o->count_label = dup(label))) return -1;
+
+	if(o->type == XDD_VAR)
+	{
+		if(!(o->sub = calloc(1, sizeof(*o->sub)))) return -1;
+		o->sub_cnt = 1;
+		return sub_load(c, o->sub, name, xml_attr(n, "PDOmapping"), p, p);
+	}
+	if(o->type != XDD_ARR && o->type != XDD_REC)
+	{
+		fprintf(stderr, "%s:%d: %04X: objectType %s not supported\n", c->path, n->line, o->index, type);
+		return -1;
+	}
+	if(!(o->sub = calloc(n->child_cnt ? n->child_cnt : 1, sizeof(*o->sub)))) return -1;
+	for(size_t i = 0; i < n->child_cnt; i++)
+	{
+		const xml_node_t *s = n->child[i];
+		if(strcmp(s->name, "CANopenSubObject")) continue;
+		const char *si = xml_attr(s, "subIndex"), *sn = xml_attr(s, "name");
+		const xml_node_t *sp = param(c, xml_attr(s, "uniqueIDRef"));
+		const unsigned long sub = si ? strtoul(si, &end, 16) : 0x100;
+		if(!si || *end || sub > 0xFF || !sn || !sp)
+		{
+			fprintf(stderr, "%s:%d: %04X: incomplete CANopenSubObject\n", c->path, s->line, o->index);
+			return -1;
+		}
+		xdd_sub_t *x = &o->sub[o->sub_cnt++];
+		x->sub = (uint8_t)sub;
+		if(sub_load(c, x, sn, xml_attr(s, "PDOmapping"), sp, p)) return -1;
+	}
+	if(!o->sub_cnt)
+	{
+		fprintf(stderr, "%s:%d: %04X: no sub-objects\n", c->path, n->line, o->index);
+		return -1;
+	}
+	qsort(o->sub, o->sub_cnt, sizeof(*o->sub), sub_cmp);
+	for(size_t i = 0; i < o->sub_cnt; i++)
+		if((i && o->sub[i].sub == o->sub[i - 1].sub) || (!i && o->sub[i].sub))
+		{
+			fprintf(stderr, "%s:%d: %04X: sub-index 0 missing or sub-index %02X twice\n", c->path, n->line, o->index, o->sub[i].sub);
+			return -1;
+		}
+	if(o->sub[0].type->kind != XDD_K_UINT || o->sub[0].type->size != 1)
+	{
+		fprintf(stderr, "%s:%d: %04X: sub-index 0 is not UNSIGNED8\n", c->path, n->line, o->index);
+		return -1;
+	}
+	if(o->type == XDD_ARR)
+		for(size_t i = 2; i < o->sub_cnt; i++)
+			if(o->sub[i].type != o->sub[1].type || o->sub[i].len != o->sub[1].len || o->sub[i].attr != o->sub[1].attr)
+			{
+				fprintf(stderr, "%s:%d: %04X: array elements differ in type or access\n", c->path, n->line, o->index);
+				return -1;
+			}
+	return 0;
+}
+
+static void text(char *out, size_t size, const xml_node_t *n)
+{
+	snprintf(out, size, "%s", n && n->text ? n->text : "");
+}
+
+// "2020-11-23" "13:00:00.0000000+02:00" -> "23/11/2020 13:00:00"
+static void date_time(char *out, size_t size, const char *date, const char *time)
+{
+	int y, m, d;
+	if(date && sscanf(date, "%d-%d-%d", &y, &m, &d) == 3)
+		snprintf(out, size, "%02d/%02d/%04d %.8s", d, m, y, time ? time : "");
+	else
+		snprintf(out, size, "%s %.8s", date ? date : "", time ? time : "");
+}
+
+static void file_info(xdd_t *x, xml_node_t *root)
+{
+	xml_node_t *body = xml_find(root, "ProfileBody");
+	if(body)
+	{
+		const char *s;
+		snprintf(x->file_name, sizeof(x->file_name), "%s", (s = xml_attr(body, "fileName")) ? s : "");
+		snprintf(x->file_version, sizeof(x->file_version), "%s", (s = xml_attr(body, "fileVersion")) ? s : "");
+		snprintf(x->created_by, sizeof(x->created_by), "%s", (s = xml_attr(body, "fileCreator")) ? s : "");
+		snprintf(x->modified_by, sizeof(x->modified_by), "%s", (s = xml_attr(body, "fileModifiedBy")) ? s : "");
+		date_time(x->created, sizeof(x->created), xml_attr(body, "fileCreationDate"), xml_attr(body, "fileCreationTime"));
+		date_time(x->modified, sizeof(x->modified), xml_attr(body, "fileModificationDate"), xml_attr(body, "fileModificationTime"));
+	}
+	xml_node_t *id = xml_find(root, "DeviceIdentity");
+	if(!id) return;
+	text(x->vendor_name, sizeof(x->vendor_name), xml_child(id, "vendorName"));
+	text(x->vendor_id, sizeof(x->vendor_id), xml_child(id, "vendorID"));
+	text(x->product_name, sizeof(x->product_name), xml_child(id, "productName"));
+	text(x->product_id, sizeof(x->product_id), xml_child(id, "productID"));
+	xml_node_t *pt = xml_child(id, "productText");
+	if(pt) text(x->description, sizeof(x->description), xml_find(pt, "description"));
+}
+
+static char *read_file(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	if(!f) return NULL;
+	char *buf = NULL;
+	if(!fseek(f, 0, SEEK_END))
+	{
+		const long size = ftell(f);
+		if(size >= 0 && !fseek(f, 0, SEEK_SET) && (buf = malloc((size_t)size + 1)) != NULL)
+		{
+			*len = fread(buf, 1, (size_t)size, f);
+			buf[*len] = 0;
+		}
+	}
+	fclose(f);
+	return buf;
+}
+
+static int collect_uids(ctx_t *c, xml_node_t *list)
+{
+	c->uid = malloc((list->child_cnt ? list->child_cnt : 1) * sizeof(*c->uid));
+	if(!c->uid) return -1;
+	for(size_t i = 0; i < list->child_cnt; i++)
+	{
+		const char *uid = xml_attr(list->child[i], "uniqueID");
+		if(uid && !strcmp(list->child[i]->name, "parameter")) c->uid[c->uid_cnt++] = (ref_t){uid, list->child[i]};
+	}
+	qsort(c->uid, c->uid_cnt, sizeof(*c->uid), uid_cmp);
+	return 0;
+}
+
+int xdd_load(xdd_t *xdd, const char *path)
+{
+	memset(xdd, 0, sizeof(*xdd));
+	size_t len = 0;
+	char *doc = read_file(path, &len);
+	if(!doc)
+	{
+		fprintf(stderr, "%s: can't read\n", path);
+		return -1;
+	}
+	int line = 0;
+	xml_node_t *root = xml_parse(doc, len, &line);
+	free(doc);
+	if(!root)
+	{
+		fprintf(stderr, line ? "%s:%d: XML syntax error\n" : "%s: out of memory\n", path, line);
+		return -1;
+	}
+
+	ctx_t c = {.path = path};
+	int ret = -1;
+	xml_node_t *params = xml_find(root, "parameterList"), *objs = xml_find(root, "CANopenObjectList");
+	if(!params || !objs)
+	{
+		fprintf(stderr, "%s: no parameterList/CANopenObjectList, not a CANopen XDD\n", path);
+		goto FIN;
+	}
+	if(collect_uids(&c, params) || !(xdd->obj = calloc(objs->child_cnt ? objs->child_cnt : 1, sizeof(*xdd->obj))))
+	{
+		fprintf(stderr, "%s: out of memory\n", path);
+		goto FIN;
+	}
+	file_info(xdd, root);
+
+	for(size_t i = 0; i < objs->child_cnt; i++)
+	{
+		const xml_node_t *n = objs->child[i];
+		if(strcmp(n->name, "CANopenObject")) continue;
+		const char *disabled = property(param(&c, xml_attr(n, "uniqueIDRef")), "CO_disabled");
+		if(disabled && !strcmp(disabled, "true")) continue;
+		if(obj_load(&c, &xdd->obj[xdd->obj_cnt++], n)) goto FIN;
+	}
+	qsort(xdd->obj, xdd->obj_cnt, sizeof(*xdd->obj), obj_cmp);
+	for(size_t i = 1; i < xdd->obj_cnt; i++)
+		if(xdd->obj[i].index == xdd->obj[i - 1].index)
+		{
+			fprintf(stderr, "%s: object %04X twice\n", path, xdd->obj[i].index);
+			goto FIN;
+		}
+	ret = 0;
+
+FIN:
+	free(c.uid);
+	xml_free(root);
+	if(ret) xdd_free(xdd);
+	return ret;
+}
+
+void xdd_free(xdd_t *xdd)
+{
+	for(size_t i = 0; i < xdd->obj_cnt; i++)
+	{
+		xdd_obj_t *o = &xdd->obj[i];
+		for(size_t s = 0; s < o->sub_cnt; s++)
+		{
+			free(o->sub[s].name);
+			free(o->sub[s].def);
+		}
+		free(o->sub);
+		free(o->name);
+		free(o->group);
+		free(o->count_label);
+	}
+	free(xdd->obj);
+	xdd->obj = NULL;
+	xdd->obj_cnt = 0;
+}
@@ -0,0 +1,76 @@
+#ifndef XDD_H__
+#define XDD_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Object dictionary of a CANopenEditor project (.xdd, .xpd) with the CANopenNode properties
+// (CO_storageGroup, CO_countLabel, CO_disabled, CO_stringLengthMin)
+
+#define XDD_VAR 7
+#define XDD_ARR 8
+#define XDD_REC 9
+
+typedef enum
+{
+	XDD_K_UINT,
+	XDD_K_INT,
+	XDD_K_REAL,
+	XDD_K_BOOL,
+	XDD_K_STR,	 // VISIBLE_STRING, char[len + 1]
+	XDD_K_OCTET, // OCTET_STRING, uint8_t[len]
+	XDD_K_DOMAIN,
+} xdd_kind_t;
+
+typedef struct
+{
+	const char *xdd;   // element name in the parameter
+	const char *ctype; // C type of the variable
+	xdd_kind_t kind;
+	uint8_t size; // bytes, 0 - strings and domain
+} xdd_type_t;
+
+// ODA_SDO_R/W, ODA_TPDO/RPDO as in CO_ODinterface.h
+#define XDD_SDO_R 0x01
+#define XDD_SDO_W 0x02
+#define XDD_TPDO 0x04
+#define XDD_RPDO 0x08
+
+typedef struct
+{
+	uint8_t sub;
+	char *name;
+	char cname[64];
+	const xdd_type_t *type;
+	uint8_t attr; // XDD_SDO_* | XDD_*PDO
+	char *def;	  // default value, NULL if none: no variable is allocated (domain, numbers)
+	size_t len;	  // strings: CO_stringLengthMin or the default, else type size
+} xdd_sub_t;
+
+typedef struct
+{
+	uint16_t index;
+	uint8_t type; // XDD_VAR/ARR/REC
+	char *name;
+	char cname[64];
+	char *group;	   // CO_storageGroup, "RAM" if none
+	char *count_label; // CO_countLabel, NULL if none
+	xdd_sub_t *sub;	   // one for a VAR, sorted by sub-index
+	size_t sub_cnt;
+} xdd_obj_t;
+
+typedef struct
+{
+	xdd_obj_t *obj; // enabled objects (no CO_disabled), sorted by index
+	size_t obj_cnt;
+	// ProfileBody and DeviceIdentity, "" if absent
+	char file_name[128], file_version[32], created[32], created_by[64], modified[32], modified_by[64];
+	char vendor_name[128], vendor_id[32], product_name[128], product_id[32], description[256];
+} xdd_t;
+
+// 0 or -1 with the reason on stderr
+int xdd_load(xdd_t *xdd, const char *path);
+void xdd_free(xdd_t *xdd);
+
+#endif // XDD_H__
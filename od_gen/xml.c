@@ -0,0 +1,357 @@
+#include "xml.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct
+{
+	const char *p, *end;
+	int line;
+	bool oom;
+} xml_in_t;
+
+static bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+static bool is_name(char c) { return c && !is_space(c) && !strchr("<>/=\"'?!", c); }
+
+static bool starts(const xml_in_t *in, const char *s)
+{
+	const size_t n = strlen(s);
+	return (size_t)(in->end - in->p) >= n && !memcmp(in->p, s, n);
+}
+
+static void adv(xml_in_t *in, size_t n)
+{
+	for(; n && in->p < in->end; n--, in->p++)
+		if(*in->p == '\n') in->line++;
+}
+
+static void skip_space(xml_in_t *in)
+{
+	while(in->p < in->end && is_space(*in->p)) adv(in, 1);
+}
+
+// Skips up to and including term, false if the document ends first
+static bool skip_past(xml_in_t *in, const char *term)
+{
+	while(in->p < in->end && !starts(in, term)) adv(in, 1);
+	if(in->p >= in->end) return false;
+	adv(in, strlen(term));
+	return true;
+}
+
+static void put_utf8(char **o, unsigned long c)
+{
+	if(c < 0x80)
+		*(*o)++ = (char)c;
+	else if(c < 0x800)
+	{
+		*(*o)++ = (char)(0xC0 | (c >> 6));
+		*(*o)++ = (char)(0x80 | (c & 0x3F));
+	}
+	else if(c < 0x10000)
+	{
+		*(*o)++ = (char)(0xE0 | (c >> 12));
+		*(*o)++ = (char)(0x80 | ((c >> 6) & 0x3F));
+		*(*o)++ = (char)(0x80 | (c & 0x3F));
+	}
+	else
+	{
+		*(*o)++ = (char)(0xF0 | (c >> 18));
+		*(*o)++ = (char)(0x80 | ((c >> 12) & 0x3F));
+		*(*o)++ = (char)(0x80 | ((c >> 6) & 0x3F));
+		*(*o)++ = (char)(0x80 | (c & 0x3F));
+	}
+}
+
+// Copy of s[0..len) with the entities decoded (never longer than the source), NULL without memory
+static char *decode(const char *s, size_t len)
+{
+	static const struct
+	{
+		const char *ent;
+		char c;
+	} ents[] = {{"&lt;", '<'}, {"&gt;", '>'}, {"&amp;", '&'}, {"&quot;", '"'}, {"&apos;", '\''}};
+	char *out = malloc(len + 1), *o = out;
+	if(!out) return NULL;
+	for(size_t i = 0; i < len;)
+	{
+		if(s[i] != '&')
+		{
+			*o++ = s[i++];
+			continue;
+		}
+		size_t k = 0;
+		for(; k < sizeof(ents) / sizeof(ents[0]); k++)
+			if(i + strlen(ents[k].ent) <= len && !strncmp(&s[i], ents[k].ent, strlen(ents[k].ent))) break;
+		if(k < sizeof(ents) / sizeof(ents[0]))
+		{
+			*o++ = ents[k].c;
+			i += strlen(ents[k].ent);
+			continue;
+		}
+		if(i + 3 < len && s[i + 1] == '#')
+		{
+			char *end;
+			const bool hex = s[i + 2] == 'x' || s[i + 2] == 'X';
+			const unsigned long c = strtoul(&s[i + (hex ? 3 : 2)], &end, hex ? 16 : 10);
+			if(*end == ';' && (size_t)(end - s) < len && c <= 0x10FFFF && (size_t)(end - &s[i]) + 1 >= 4)
+			{
+				put_utf8(&o, c); // "&#N;" is at least 4 bytes, UTF-8 of N at most 4
+				i = (size_t)(end - s) + 1;
+				continue;
+			}
+		}
+		*o++ = s[i++];
+	}
+	*o = 0;
+	return out;
+}
+
+// arr with room for element cnt: capacity 4, then doubled when full. NULL without memory, arr stays valid
+static void *grow(void *arr, size_t cnt, size_t size)
+{
+	if(cnt && (cnt < 4 || (cnt & (cnt - 1)))) return arr;
+	return realloc(arr, (cnt ? cnt * 2 : 4) * size);
+}
+
+static bool append_text(xml_node_t *n, const char *s, size_t len)
+{
+	char *t = decode(s, len);
+	if(!t) return false;
+	if(!n->text)
+	{
+		n->text = t;
+		return true;
+	}
+	const size_t old = strlen(n->text);
+	char *j = realloc(n->text, old + strlen(t) + 1);
+	if(!j)
+	{
+		free(t);
+		return false;
+	}
+	strcpy(j + old, t);
+	free(t);
+	n->text = j;
+	return true;
+}
+
+static char *name_dup(xml_in_t *in)
+{
+	const char *s = in->p;
+	while(in->p < in->end && is_name(*in->p)) in->p++;
+	if(in->p == s) return NULL;
+	const char *colon = memchr(s, ':', (size_t)(in->p - s)), *l = colon ? colon + 1 : s;
+	char *name = malloc((size_t)(in->p - l) + 1);
+	if(!name)
+	{
+		in->oom = true;
+		return NULL;
+	}
+	memcpy(name, l, (size_t)(in->p - l));
+	name[in->p - l] = 0;
+	return name;
+}
+
+// Element at in->p ('<' of the start tag), NULL on error
+static xml_node_t *element(xml_in_t *in, int depth)
+{
+	if(depth > 64) return NULL;
+	xml_node_t *n = calloc(1, sizeof(*n));
+	if(!n)
+	{
+		in->oom = true;
+		return NULL;
+	}
+	n->line = in->line;
+	adv(in, 1);
+	const char *tag = in->p;
+	if(!(n->name = name_dup(in))) goto ERR;
+	const size_t tag_len = (size_t)(in->p - tag);
+
+	for(;;) // attributes
+	{
+		skip_space(in);
+		if(starts(in, "/>"))
+		{
+			adv(in, 2);
+			return n;
+		}
+		if(starts(in, ">"))
+		{
+			adv(in, 1);
+			break;
+		}
+		xml_attr_t *attr = grow(n->attr, n->attr_cnt, sizeof(*n->attr));
+		if(!attr)
+		{
+			in->oom = true;
+			goto ERR;
+		}
+		n->attr = attr;
+		xml_attr_t *a = &n->attr[n->attr_cnt];
+		if(!(a->name = name_dup(in))) goto ERR;
+		a->value = NULL;
+		n->attr_cnt++;
+		skip_space(in);
+		if(!starts(in, "=")) goto ERR;
+		adv(in, 1);
+		skip_space(in);
+		if(in->p >= in->end || (*in->p != '"' && *in->p != '\'')) goto ERR;
+		const char q = *in->p, *v = in->p + 1;
+		adv(in, 1);
+		while(in->p < in->end && *in->p != q) adv(in, 1);
+		if(in->p >= in->end) goto ERR;
+		if(!(a->value = decode(v, (size_t)(in->p - v))))
+		{
+			in->oom = true;
+			goto ERR;
+		}
+		adv(in, 1);
+	}
+
+	for(;;) // content
+	{
+		const char *t = in->p;
+		while(in->p < in->end && *in->p != '<') adv(in, 1);
+		if(in->p >= in->end) goto ERR;
+		if(in->p > t)
+		{
+			const char *s = t;
+			while(s < in->p && is_space(*s)) s++;
+			if(s < in->p && !append_text(n, t, (size_t)(in->p - t)))
+			{
+				in->oom = true;
+				goto ERR;
+			}
+		}
+		if(starts(in, "<!--"))
+		{
+			if(!skip_past(in, "-->")) goto ERR;
+		}
+		else if(starts(in, "<![CDATA["))
+		{
+			adv(in, 9);
+			const char *c = in->p;
+			if(!skip_past(in, "]]>")) goto ERR;
+			char *raw = malloc((size_t)(in->p - 3 - c) + 1); // CDATA is taken as is, no entities
+			if(!raw)
+			{
+				in->oom = true;
+				goto ERR;
+			}
+			memcpy(raw, c, (size_t)(in->p - 3 - c));
+			raw[in->p - 3 - c] = 0;
+			const size_t old = n->text ? strlen(n->text) : 0;
+			char *j = realloc(n->text, old + strlen(raw) + 1);
+			if(!j)
+			{
+				free(raw);
+				in->oom = true;
+				goto ERR;
+			}
+			strcpy(j + old, raw);
+			free(raw);
+			n->text = j;
+		}
+		else if(starts(in, "<?"))
+		{
+			if(!skip_past(in, "?>")) goto ERR;
+		}
+		else if(starts(in, "</"))
+		{
+			adv(in, 2);
+			if((size_t)(in->end - in->p) < tag_len || memcmp(in->p, tag, tag_len)) goto ERR;
+			adv(in, tag_len);
+			skip_space(in);
+			if(!starts(in, ">")) goto ERR;
+			adv(in, 1);
+			return n;
+		}
+		else
+		{
+			xml_node_t **child = grow(n->child, n->child_cnt, sizeof(*n->child));
+			if(!child)
+			{
+				in->oom = true;
+				goto ERR;
+			}
+			n->child = child;
+			xml_node_t *c = element(in, depth + 1);
+			if(!c) goto ERR;
+			n->child[n->child_cnt++] = c;
+		}
+	}
+
+ERR:
+	xml_free(n);
+	return NULL;
+}
+
+xml_node_t *xml_parse(const char *doc, size_t len, int *err_line)
+{
+	xml_in_t in = {.p = doc, .end = doc + len, .line = 1};
+	if(starts(&in, "\xEF\xBB\xBF")) adv(&in, 3); // UTF-8 BOM
+	for(;;) // prolog: declaration, comments, doctype
+	{
+		skip_space(&in);
+		bool ok = true;
+		if(starts(&in, "<?"))
+			ok = skip_past(&in, "?>");
+		else if(starts(&in, "<!--"))
+			ok = skip_past(&in, "-->");
+		else if(starts(&in, "<!"))
+			ok = skip_past(&in, ">");
+		else
+			break;
+		if(!ok)
+		{
+			*err_line = in.line;
+			return NULL;
+		}
+	}
+	xml_node_t *root = starts(&in, "<") ? element(&in, 0) : NULL;
+	if(!root) *err_line = in.oom ? 0 : in.line;
+	return root;
+}
+
+void xml_free(xml_node_t *n)
+{
+	if(!n) return;
+	for(size_t i = 0; i < n->attr_cnt; i++)
+	{
+		free(n->attr[i].name);
+		free(n->attr[i].value);
+	}
+	for(size_t i = 0; i < n->child_cnt; i++) xml_free(n->child[i]);
+	free(n->attr);
+	free(n->child);
+	free(n->name);
+	free(n->text);
+	free(n);
+}
+
+const char *xml_attr(const xml_node_t *n, const char *name)
+{
+	for(size_t i = 0; i < n->attr_cnt; i++)
+		if(!strcmp(n->attr[i].name, name)) return n->attr[i].value;
+	return NULL;
+}
+
+xml_node_t *xml_child(const xml_node_t *n, const char *name)
+{
+	for(size_t i = 0; i < n->child_cnt; i++)
+		if(!strcmp(n->child[i]->name, name)) return n->child[i];
+	return NULL;
+}
+
+xml_node_t *xml_find(xml_node_t *n, const char *name)
+{
+	if(!strcmp(n->name, name)) return n;
+	for(size_t i = 0; i < n->child_cnt; i++)
+	{
+		xml_node_t *f = xml_find(n->child[i], name);
+		if(f) return f;
+	}
+	return NULL;
+}
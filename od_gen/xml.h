@@ -0,0 +1,36 @@
+#ifndef XML_H__
+#define XML_H__
+
+#include <stddef.h>
+
+// Minimal XML reader for the CANopenEditor files: elements, attributes, character data, comments, CDATA.
+// No DTD, no namespaces: "q1:parameter" is "parameter"
+
+typedef struct
+{
+	char *name;
+	char *value; // entities decoded
+} xml_attr_t;
+
+typedef struct xml_node_s
+{
+	char *name; // without namespace prefix
+	xml_attr_t *attr;
+	size_t attr_cnt;
+	struct xml_node_s **child;
+	size_t child_cnt;
+	char *text; // character data of the element itself, entities decoded, NULL if none
+	int line;
+} xml_node_t;
+
+// Root element of the document, NULL on error with the line in *err_line (0 - out of memory)
+xml_node_t *xml_parse(const char *doc, size_t len, int *err_line);
+void xml_free(xml_node_t *n);
+
+const char *xml_attr(const xml_node_t *n, const char *name);
+// First child named name, NULL if none
+xml_node_t *xml_child(const xml_node_t *n, const char *name);
+// First element named name in the subtree of n (n included), depth first
+xml_node_t *xml_find(xml_node_t *n, const char *name);
+
+#endif // XML_H__
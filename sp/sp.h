@@ -7,6 +7,7 @@
 
 #define SP_WRITE_TIMEOUT_MS 500
 #define SP_RX_SIZE 1024
+#define SP_RX_RING_SIZE 4096 // default rx ring size, power of two
 
 #define SP_INFO_LEN 256
 
@@ -32,6 +33,7 @@ enum
 	SP_ERR_CREATE_OVERLAP_OBJ,
 	SP_ERR_CREATE_THREAD,
 	SP_ERR_PARAM,
+	SP_ERR_RX_RING,
 };
 
 typedef enum
@@ -103,6 +105,17 @@ typedef struct
 } sp_list_t;
 #endif
 
+#if defined(_WIN32)
+typedef struct
+{
+	void *iov_base;
+	size_t iov_len;
+} sp_iovec_t;
+#else
+#include <sys/uio.h>
+typedef struct iovec sp_iovec_t;
+#endif
+
 typedef struct sp_t sp_t;
 
 struct sp_t
@@ -110,9 +123,15 @@ struct sp_t
 	char port_name[SP_INFO_LEN];
 	volatile bool thr_run;
 	int thr_error;
-	void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len);
+	size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len); // returns the number of bytes released, the rest is passed again with the next data
 	void (*cb_err)(sp_t *sp);
-	uint8_t data_rx[SP_RX_SIZE];
+	struct
+	{
+		uint8_t *buf;	   // mirrored: buf[i] == buf[i + size], so any unreleased span is contiguous
+		size_t size;	   // may be set before sp_open(), rounded up to power of two (0 - SP_RX_RING_SIZE)
+		size_t head, tail; // written by the reader, released by cb_rx; free running
+		uint32_t ovf;	   // ring was full and nothing was released: unreleased data dropped
+	} rx;
 	void *priv;
 
 #if defined(_WIN32)
@@ -124,7 +143,7 @@ struct sp_t
 	HANDLE write_mutex;
 #else
 	int fd;
-	pthread_t thr_rcv;
+	sp_t *reactor_next; // registry of ports served by the shared reader thread
 	volatile bool thr_exited;
 	bool xonxoff, rtscts;
 	pthread_mutex_t write_mutex;
@@ -136,13 +155,15 @@ const char *sp_err2_str(int code);
 int sp_enumerate(sp_list_t *list);
 void sp_enumerate_finish(sp_list_t *list);
 
-int sp_open(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv);
-int sp_open_ext(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
+int sp_open(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv);
+int sp_open_ext(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
 				uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits, sp_flowcontrol_t flowcontrol);
 // 115200, SP_BYTESIZE_8, SP_PARITY_NONE, SP_STOP_BITS_1, SP_FLOW_NONE
 void sp_close(sp_t *sp);
 
 int sp_write(sp_t *sp, const void *data, size_t size);
+// Gather write without waiting for the port: *written is less than total if the OS buffer is full
+int sp_writev(sp_t *sp, const sp_iovec_t *iov, int iovcnt, size_t *written);
 
 int sp_flush(sp_t *sp);
 int sp_flush_rx(sp_t *sp);
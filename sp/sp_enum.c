@@ -25,6 +25,7 @@ const char *sp_err2_str(int code)
 	case SP_ERR_CREATE_OVERLAP_OBJ: return "CREATE OVERLAP OBJ";
 	case SP_ERR_CREATE_THREAD: return "CREATE THREAD";
 	case SP_ERR_PARAM: return "PARAM";
+	case SP_ERR_RX_RING: return "RX RING";
 	default: return "Unknown";
 	}
 }
@@ -1,4 +1,7 @@
 // version: 1
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // memfd_create
+#endif
 #include "sp.h"
 
 #if !defined(_WIN32)
@@ -10,11 +13,14 @@
 #include <stdio.h>
 #include <string.h>
 #include <sys/ioctl.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
 #include <sys/param.h>
-#include <sys/select.h>
 #include <sys/signal.h>
 #include <sys/time.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <sysexits.h>
 #include <termios.h>
 #include <time.h>
@@ -32,48 +38,258 @@
 #endif
 #endif
 
+#define SP_REACTOR_EVENTS 16
+
+// Rx ring is one memfd mapped twice back to back, so a span crossing the end of the ring is still contiguous
+static int rx_ring_alloc(sp_t *sp)
+{
+	size_t size = (size_t)sysconf(_SC_PAGESIZE);
+	while(size < (sp->rx.size ? sp->rx.size : SP_RX_RING_SIZE))
+		size <<= 1;
+
+	int fd = memfd_create("sp_rx", MFD_CLOEXEC);
+	if(fd < 0) return SP_ERR_RX_RING;
+	uint8_t *base = MAP_FAILED;
+	if(ftruncate(fd, (off_t)size) == 0) base = mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if(base == MAP_FAILED ||
+	   mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+	   mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+	{
+		if(base != MAP_FAILED) munmap(base, 2 * size);
+		close(fd);
+		return SP_ERR_RX_RING;
+	}
+	close(fd);
+	sp->rx.buf = base;
+	sp->rx.size = size;
+	sp->rx.head = sp->rx.tail = 0;
+	sp->rx.ovf = 0;
+	return 0;
+}
+
+static void rx_ring_free(sp_t *sp)
+{
+	if(sp->rx.buf) munmap(sp->rx.buf, 2 * sp->rx.size);
+	sp->rx.buf = NULL;
+}
+
+// One reader thread serves all opened ports
+static struct
+{
+	pthread_mutex_t lock;	   // guards the registry, not held while calling back
+	pthread_cond_t idle;	   // busy port done, sp_close() may free it
+	pthread_mutex_t lifecycle; // serialises thread start/stop in sp_open()/sp_close()
+	pthread_t thr;
+	int epfd, evfd;
+	sp_t *ports;
+	sp_t *busy;		// port being dispatched
+	bool self_stop; // last port closed from a callback: the thread cleans up after itself
+	volatile bool run;
+} reactor = {.lock = PTHREAD_MUTEX_INITIALIZER,
+			 .idle = PTHREAD_COND_INITIALIZER,
+			 .lifecycle = PTHREAD_MUTEX_INITIALIZER,
+			 .epfd = -1,
+			 .evfd = -1};
+
+static bool reactor_has(sp_t *sp)
+{
+	for(sp_t *p = reactor.ports; p; p = p->reactor_next)
+	{
+		if(p == sp) return true;
+	}
+	return false;
+}
+
+// Read and call back one port, unlocked: the callbacks may sp_write(), sp_close() or sp_open() any port
+static void reactor_dispatch(sp_t *sp)
+{
+	ssize_t readed = read(sp->fd, sp->rx.buf + (sp->rx.head & (sp->rx.size - 1)), sp->rx.size - (sp->rx.head - sp->rx.tail));
+	if(readed < 0 && (errno == EAGAIN || errno == EINTR)) return;
+	if(readed <= 0)
+	{
+		epoll_ctl(reactor.epfd, EPOLL_CTL_DEL, sp->fd, NULL);
+		sp->thr_error = SP_ERR_READ;
+		sp->thr_exited = true;
+		if(sp->cb_err) sp->cb_err(sp);
+		return;
+	}
+	sp->rx.head += (size_t)readed;
+	const size_t used = sp->cb_rx(sp, sp->rx.buf + (sp->rx.tail & (sp->rx.size - 1)), sp->rx.head - sp->rx.tail);
+
+	pthread_mutex_lock(&reactor.lock);
+	if(reactor_has(sp)) // not closed by the callback
+	{
+		sp->rx.tail += used;
+		if(sp->rx.head - sp->rx.tail == sp->rx.size) // consumer is stuck on a full ring
+		{
+			sp->rx.tail = sp->rx.head;
+			sp->rx.ovf++;
+		}
+	}
+	pthread_mutex_unlock(&reactor.lock);
+}
+
 static void *thr_rcv(void *arg)
 {
-	sp_t *sp = (sp_t *)arg;
-	fd_set rfds;
-	while(sp->thr_run)
+	(void)arg;
+	struct epoll_event ev[SP_REACTOR_EVENTS];
+	for(;;)
 	{
-		FD_ZERO(&rfds);
-		FD_SET(sp->fd, &rfds);
-		struct timeval tv = {.tv_sec = 0, .tv_usec = 10 /*ms*/ * 1000};
-		int n = select(sp->fd + 1, &rfds, 0, 0, &tv);
-		if(n > 0)
+		while(reactor.run)
 		{
-			if(FD_ISSET(sp->fd, &rfds))
+			int n = epoll_wait(reactor.epfd, ev, SP_REACTOR_EVENTS, -1);
+			if(n < 0)
+			{
+				if(errno == EINTR) continue;
+				return 0;
+			}
+			for(int i = 0; i < n; i++)
 			{
-				// int bytes_available = 0;
-				// if(-1 != ioctl(sp->fd, TIOCINQ, &bytes_available)) {}
-				uint32_t readed = read(sp->fd, sp->data_rx, SP_RX_SIZE);
-				if(readed <= 0)
+				sp_t *sp = (sp_t *)ev[i].data.ptr;
+				if(!sp)
 				{
-					sp->thr_error = SP_ERR_READ;
-					if(sp->cb_err) sp->cb_err(sp);
-					sp->thr_exited = true;
-					return 0;
+					uint64_t v;
+					if(read(reactor.evfd, &v, sizeof(v)) < 0) {}
+					continue;
 				}
-				sp->cb_rx(sp, sp->data_rx, readed);
+				pthread_mutex_lock(&reactor.lock);
+				const bool open = reactor_has(sp) && !sp->thr_exited; // closed while this event was pending
+				if(open) reactor.busy = sp;
+				pthread_mutex_unlock(&reactor.lock);
+				if(!open) continue;
+
+				reactor_dispatch(sp);
+
+				pthread_mutex_lock(&reactor.lock);
+				reactor.busy = NULL;
+				pthread_cond_broadcast(&reactor.idle);
+				pthread_mutex_unlock(&reactor.lock);
 			}
 		}
-		else if(n < 0)
+
+		pthread_mutex_lock(&reactor.lock);
+		if(reactor.run) // sp_open() from a callback took the thread over again
+		{
+			pthread_mutex_unlock(&reactor.lock);
+			continue;
+		}
+		if(reactor.self_stop) // nobody joins
 		{
-			sp->thr_error = SP_ERR_READ;
-			if(sp->cb_err) sp->cb_err(sp);
-			sp->thr_exited = true;
-			return 0;
+			pthread_detach(pthread_self());
+			close(reactor.epfd);
+			close(reactor.evfd);
+			reactor.epfd = reactor.evfd = -1;
+			reactor.self_stop = false;
 		}
+		pthread_mutex_unlock(&reactor.lock);
+		return 0;
 	}
-	sp->thr_exited = true;
-	return 0;
 }
 
-int sp_open(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv)
+static int reactor_add(sp_t *sp)
+{
+	int sts = 0;
+	pthread_mutex_lock(&reactor.lifecycle);
+	pthread_mutex_lock(&reactor.lock);
+	if(reactor.epfd >= 0 && !reactor.run) // stopping itself after the last sp_close() from a callback
+	{
+		reactor.run = true;
+		reactor.self_stop = false;
+	}
+	if(reactor.epfd < 0)
+	{
+		reactor.epfd = epoll_create1(EPOLL_CLOEXEC);
+		reactor.evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL};
+		reactor.run = true;
+		if(reactor.epfd < 0 || reactor.evfd < 0 ||
+		   epoll_ctl(reactor.epfd, EPOLL_CTL_ADD, reactor.evfd, &ev) ||
+		   pthread_create(&reactor.thr, NULL, thr_rcv, NULL))
+		{
+			if(reactor.epfd >= 0) close(reactor.epfd);
+			if(reactor.evfd >= 0) close(reactor.evfd);
+			reactor.epfd = reactor.evfd = -1;
+			sts = SP_ERR_CREATE_THREAD;
+		}
+	}
+	if(!sts)
+	{
+		struct epoll_event ev = {.events = EPOLLIN, .data.ptr = sp};
+		if(epoll_ctl(reactor.epfd, EPOLL_CTL_ADD, sp->fd, &ev))
+			sts = SP_ERR_CREATE_THREAD;
+		else
+		{
+			sp->reactor_next = reactor.ports;
+			reactor.ports = sp;
+		}
+	}
+	pthread_mutex_unlock(&reactor.lock);
+	pthread_mutex_unlock(&reactor.lifecycle);
+	return sts;
+}
+
+static void reactor_remove(sp_t *sp)
+{
+	pthread_mutex_lock(&reactor.lifecycle);
+	pthread_mutex_lock(&reactor.lock);
+	if(!reactor_has(sp))
+	{
+		pthread_mutex_unlock(&reactor.lock);
+		pthread_mutex_unlock(&reactor.lifecycle);
+		return;
+	}
+	epoll_ctl(reactor.epfd, EPOLL_CTL_DEL, sp->fd, NULL);
+	for(sp_t **p = &reactor.ports; *p; p = &(*p)->reactor_next)
+	{
+		if(*p == sp)
+		{
+			*p = sp->reactor_next;
+			break;
+		}
+	}
+	sp->reactor_next = NULL;
+	const bool self = pthread_equal(pthread_self(), reactor.thr);
+	while(!self && reactor.busy == sp) // its callback is running
+		pthread_cond_wait(&reactor.idle, &reactor.lock);
+	bool last = !reactor.ports;
+	if(last) reactor.run = false;
+	if(last && self)
+	{
+		reactor.self_stop = true;
+		last = false;
+	}
+	pthread_mutex_unlock(&reactor.lock);
+
+	if(last) // last port: stop the thread, it is restarted by the next sp_open()
+	{
+		uint64_t v = 1;
+		if(write(reactor.evfd, &v, sizeof(v)) < 0) {}
+		pthread_join(reactor.thr, NULL);
+		close(reactor.epfd);
+		close(reactor.evfd);
+		reactor.epfd = reactor.evfd = -1;
+	}
+	pthread_mutex_unlock(&reactor.lifecycle);
+}
+
+// Port state of sp_open() besides the reactor registration, also after a failed open
+static void sp_release(sp_t *sp)
+{
+	if(sp->fd != -1 && sp->fd) close(sp->fd);
+	pthread_mutex_destroy(&sp->write_mutex);
+	rx_ring_free(sp);
+	sp->fd = -1;
+}
+
+int sp_open(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv)
 {
 	pthread_mutex_init(&sp->write_mutex, NULL);
+	sp->fd = -1;
+	if(rx_ring_alloc(sp))
+	{
+		sp_release(sp);
+		return SP_ERR_RX_RING;
+	}
 	sp->cb_rx = cb_rx;
 	sp->priv = priv;
 	if(port_name) memcpy(sp->port_name, port_name, MIN(strlen(port_name), sizeof(sp->port_name)));
@@ -82,14 +298,17 @@ OPEN_AGAIN:
 	sp->fd = open(sp->port_name, O_RDWR | O_NOCTTY | O_NONBLOCK);
 	if(sp->fd == -1)
 	{
+		int sts;
 		switch(errno)
 		{
 		case EINTR: printf("SP: recurse\n"); goto OPEN_AGAIN; // Recurse because this is a recoverable error
-		case EACCES: return SP_ERR_PORT_OPEN_BUSY;
-		case ENXIO: return SP_ERR_PORT_NOT_EXIST;
-		case ENOENT: return SP_ERR_PORT_OPEN_INVALID;
-		default: return SP_ERR_PORT_OPEN;
+		case EACCES: sts = SP_ERR_PORT_OPEN_BUSY; break;
+		case ENXIO: sts = SP_ERR_PORT_NOT_EXIST; break;
+		case ENOENT: sts = SP_ERR_PORT_OPEN_INVALID; break;
+		default: sts = SP_ERR_PORT_OPEN; break;
 		}
+		sp_release(sp);
+		return sts;
 	}
 
 	struct termios options;
@@ -101,17 +320,16 @@ OPEN_AGAIN:
 
 	sp_flush(sp);
 	sp->thr_run = true;
-	if(pthread_create(&sp->thr_rcv, NULL, thr_rcv, sp)) return SP_ERR_CREATE_THREAD;
-
-	return 0;
+	sp->thr_exited = false;
+	sp->thr_error = 0;
+	const int sts = reactor_add(sp);
+	if(sts) sp_release(sp);
+	return sts;
 }
 
-int sp_open_ext(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
-				uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits, sp_flowcontrol_t flowcontrol)
+static int sp_configure(sp_t *sp, uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits,
+						sp_flowcontrol_t flowcontrol)
 {
-	int sts = sp_open(sp, port_name, cb_rx, priv);
-	if(sts) return sts;
-
 	struct termios options;
 	if(tcgetattr(sp->fd, &options) == -1) return SP_ERR_GET_COMM_STATE;
 
@@ -270,17 +488,23 @@ int sp_open_ext(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const u
 	return 0;
 }
 
+int sp_open_ext(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
+				uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits, sp_flowcontrol_t flowcontrol)
+{
+	int sts = sp_open(sp, port_name, cb_rx, priv);
+	if(sts) return sts;
+	sts = sp_configure(sp, baudrate, bytesize, parity, stopbits, flowcontrol);
+	if(sts) sp_close(sp); // the port stays closed on any error
+	return sts;
+}
+
 void sp_close(sp_t *sp)
 {
 	if(sp->thr_exited) printf("[SP] thread exited!\n");
 	sp->thr_run = false;
-	pthread_join(sp->thr_rcv, NULL);
+	reactor_remove(sp);
 	if(sp->thr_error) printf("[SP] thread error: %s\n", sp_err2_str(sp->thr_error));
-
-	if(sp->fd != -1 && sp->fd) close(sp->fd);
-	pthread_mutex_destroy(&sp->write_mutex);
-
-	sp->fd = -1;
+	sp_release(sp);
 }
 
 int sp_write(sp_t *sp, const void *data, size_t size)
@@ -298,6 +522,20 @@ int sp_write(sp_t *sp, const void *data, size_t size)
 	return (int)size == bytes_written ? 0 : (bytes_written <= 0 ? SP_ERR_WR_ZERO : SP_ERR_WR_LESS);
 }
 
+int sp_writev(sp_t *sp, const sp_iovec_t *iov, int iovcnt, size_t *written)
+{
+	*written = 0;
+	if(pthread_mutex_lock(&sp->write_mutex)) return SP_ERR_WR_LOCK;
+	int sts = 0;
+	ssize_t bytes_written = writev(sp->fd, iov, iovcnt);
+	if(bytes_written >= 0)
+		*written = (size_t)bytes_written;
+	else if(errno != EAGAIN && errno != EINTR) // EWOULDBLOCK == EAGAIN on Linux
+		sts = SP_ERR_WR_ZERO;
+	if(pthread_mutex_unlock(&sp->write_mutex)) return SP_ERR_WR_UNLOCK;
+	return sts;
+}
+
 int sp_flush(sp_t *sp)
 {
 	if(pthread_mutex_lock(&sp->write_mutex)) return SP_ERR_WR_LOCK;
@@ -5,11 +5,45 @@
 #if defined(_WIN32)
 #include <fcntl.h>
 #include <process.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define SERIAL_OVERLAP_MODE
 
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 
+// Rx ring is allocated twice the size; the head of the ring is copied behind its end only when an unreleased span wraps
+static int rx_ring_alloc(sp_t *sp)
+{
+	size_t size = SP_RX_SIZE;
+	while(size < (sp->rx.size ? sp->rx.size : SP_RX_RING_SIZE))
+		size <<= 1;
+	sp->rx.buf = (uint8_t *)malloc(2 * size);
+	if(!sp->rx.buf) return SP_ERR_RX_RING;
+	sp->rx.size = size;
+	sp->rx.head = sp->rx.tail = 0;
+	sp->rx.ovf = 0;
+	return 0;
+}
+
+static void rx_ring_free(sp_t *sp)
+{
+	free(sp->rx.buf);
+	sp->rx.buf = NULL;
+}
+
+static void rx_ring_dispatch(sp_t *sp)
+{
+	const size_t mask = sp->rx.size - 1, len = sp->rx.head - sp->rx.tail;
+	if((sp->rx.tail & mask) + len > sp->rx.size) memcpy(sp->rx.buf + sp->rx.size, sp->rx.buf, (sp->rx.tail & mask) + len - sp->rx.size);
+	sp->rx.tail += sp->cb_rx(sp, sp->rx.buf + (sp->rx.tail & mask), len);
+	if(sp->rx.head - sp->rx.tail == sp->rx.size) // consumer is stuck on a full ring
+	{
+		sp->rx.tail = sp->rx.head;
+		sp->rx.ovf++;
+	}
+}
+
 static unsigned int __stdcall thr_rcv(void *data)
 {
 	sp_t *sp = (sp_t *)data;
@@ -62,25 +96,40 @@ static unsigned int __stdcall thr_rcv(void *data)
 		{
 			for(DWORD p = 0; p < bytes_to_read;)
 			{
+				const size_t pos = sp->rx.head & (sp->rx.size - 1);
 				DWORD sz = bytes_to_read - p;
-				if(sz > SP_RX_SIZE) sz = SP_RX_SIZE;
+				sz = MIN(sz, sp->rx.size - (sp->rx.head - sp->rx.tail)); // free space
+				sz = MIN(sz, sp->rx.size - pos);						  // up to the end of the ring
 				p += sz;
-				if(!ReadFile(sp->fd, sp->data_rx, sz, &readed, &sp->fd_overlap_read))
+				if(!ReadFile(sp->fd, sp->rx.buf + pos, sz, &readed, &sp->fd_overlap_read))
 				{
 					sp->thr_error = SP_ERR_READ;
 					if(sp->cb_err) sp->cb_err(sp);
 					return 0;
 				}
-				if(readed > 0) sp->cb_rx(sp, sp->data_rx, readed);
+				if(readed > 0)
+				{
+					sp->rx.head += readed;
+					rx_ring_dispatch(sp);
+				}
 			}
 		}
 	}
 	return 0;
 }
 
-int sp_open(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv)
+int sp_open(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv)
 {
+	int sts = 0;
+	sp->thr_rcv = NULL;
+	sp->fd = INVALID_HANDLE_VALUE;
+	sp->fd_overlap_read.hEvent = sp->fd_overlap_write.hEvent = sp->fd_overlap_evt.hEvent = NULL;
 	sp->write_mutex = CreateMutex(NULL, false, NULL);
+	if(rx_ring_alloc(sp))
+	{
+		sts = SP_ERR_RX_RING;
+		goto FAIL;
+	}
 	sp->cb_rx = cb_rx;
 	sp->priv = priv;
 	if(port_name) memcpy(sp->port_name, port_name, MIN(strlen(port_name), sizeof(sp->port_name)));
@@ -95,11 +144,12 @@ int sp_open(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8
 	{
 		switch(GetLastError())
 		{
-		case ERROR_FILE_NOT_FOUND: return SP_ERR_PORT_NOT_EXIST;
-		case ERROR_ACCESS_DENIED: return SP_ERR_PORT_OPEN_BUSY;
-		case ERROR_PATH_NOT_FOUND: return SP_ERR_PORT_OPEN_INVALID;
-		default: return SP_ERR_PORT_OPEN;
+		case ERROR_FILE_NOT_FOUND: sts = SP_ERR_PORT_NOT_EXIST; break;
+		case ERROR_ACCESS_DENIED: sts = SP_ERR_PORT_OPEN_BUSY; break;
+		case ERROR_PATH_NOT_FOUND: sts = SP_ERR_PORT_OPEN_INVALID; break;
+		default: sts = SP_ERR_PORT_OPEN; break;
 		}
+		goto FAIL;
 	}
 
 	COMMTIMEOUTS timeouts = {0};
@@ -110,31 +160,49 @@ int sp_open(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8
 	timeouts.WriteTotalTimeoutConstant = 5 /*write_timeout_constant*/;	   // constant number of milliseconds to wait after calling write
 	timeouts.WriteTotalTimeoutMultiplier = 1 /*write_timeout_multiplier*/; // multiplier against the number of requested bytes to wait after calling write
 #endif
-	if(!SetCommTimeouts(sp->fd, &timeouts)) return SP_ERR_SET_TO;
+	if(!SetCommTimeouts(sp->fd, &timeouts))
+	{
+		sts = SP_ERR_SET_TO;
+		goto FAIL;
+	}
 
 #ifdef SERIAL_OVERLAP_MODE
-	if(!SetCommMask(sp->fd, EV_RXCHAR)) return SP_ERR_SET_COMM_MASK;
+	if(!SetCommMask(sp->fd, EV_RXCHAR))
+	{
+		sts = SP_ERR_SET_COMM_MASK;
+		goto FAIL;
+	}
 	sp->fd_overlap_read.hEvent = CreateEvent(NULL, true, false, NULL);
 	sp->fd_overlap_write.hEvent = CreateEvent(NULL, true, false, NULL);
 	sp->fd_overlap_evt.hEvent = CreateEvent(NULL, true, false, NULL);
-	if(!sp->fd_overlap_read.hEvent || !sp->fd_overlap_write.hEvent || !sp->fd_overlap_evt.hEvent) return SP_ERR_CREATE_OVERLAP_OBJ;
+	if(!sp->fd_overlap_read.hEvent || !sp->fd_overlap_write.hEvent || !sp->fd_overlap_evt.hEvent)
+	{
+		sts = SP_ERR_CREATE_OVERLAP_OBJ;
+		goto FAIL;
+	}
 	PurgeComm(sp->fd, PURGE_RXCLEAR | PURGE_TXCLEAR | PURGE_TXABORT | PURGE_RXABORT);
 #endif
 
 	sp_flush(sp);
 	sp->thr_run = true;
 	sp->thr_rcv = (HANDLE)_beginthreadex(0, 0, &thr_rcv, sp, 0, 0);
-	if(!sp->thr_rcv || sp->thr_rcv == INVALID_HANDLE_VALUE) return SP_ERR_CREATE_THREAD;
+	if(!sp->thr_rcv || sp->thr_rcv == INVALID_HANDLE_VALUE)
+	{
+		sts = SP_ERR_CREATE_THREAD;
+		goto FAIL;
+	}
 
 	return 0;
+
+FAIL:
+	sp->thr_rcv = NULL; // never started
+	sp_close(sp);
+	return sts;
 }
 
-int sp_open_ext(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
-				uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits, sp_flowcontrol_t flowcontrol)
+static int sp_configure(sp_t *sp, uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits,
+						sp_flowcontrol_t flowcontrol)
 {
-	int sts = sp_open(sp, port_name, cb_rx, priv);
-	if(sts) return sts;
-
 	DCB dcbSerialParams = {0};
 	dcbSerialParams.DCBlength = sizeof(dcbSerialParams);
 	if(!GetCommState(sp->fd, &dcbSerialParams)) return SP_ERR_GET_COMM_STATE;
@@ -212,6 +280,16 @@ int sp_open_ext(sp_t *sp, const char *port_name, void (*cb_rx)(sp_t *sp, const u
 	return 0;
 }
 
+int sp_open_ext(sp_t *sp, const char *port_name, size_t (*cb_rx)(sp_t *sp, const uint8_t *data, size_t len), void *priv,
+				uint32_t baudrate, sp_bytesize_t bytesize, sp_parity_t parity, sp_stopbits_t stopbits, sp_flowcontrol_t flowcontrol)
+{
+	int sts = sp_open(sp, port_name, cb_rx, priv);
+	if(sts) return sts;
+	sts = sp_configure(sp, baudrate, bytesize, parity, stopbits, flowcontrol);
+	if(sts) sp_close(sp); // the port stays closed on any error
+	return sts;
+}
+
 void sp_close(sp_t *sp)
 {
 	if(WaitForSingleObject(sp->thr_rcv, 0) == WAIT_OBJECT_0) printf("[SP] thread exited!\n");
@@ -227,6 +305,8 @@ void sp_close(sp_t *sp)
 	if(sp->fd_overlap_write.hEvent) CloseHandle(sp->fd_overlap_write.hEvent);
 	if(sp->fd_overlap_evt.hEvent) CloseHandle(sp->fd_overlap_evt.hEvent);
 
+	rx_ring_free(sp);
+
 	sp->thr_rcv = NULL;
 	sp->fd = INVALID_HANDLE_VALUE;
 	sp->write_mutex = NULL;
@@ -257,6 +337,33 @@ int sp_write(sp_t *sp, const void *data, size_t size)
 	return size == bytes_written ? 0 : (bytes_written == 0 ? SP_ERR_WR_ZERO : SP_ERR_WR_LESS);
 }
 
+int sp_writev(sp_t *sp, const sp_iovec_t *iov, int iovcnt, size_t *written)
+{
+	uint8_t buf[SP_RX_SIZE * 4];
+	size_t len = 0;
+	*written = 0;
+	for(int i = 0; i < iovcnt; i++)
+	{
+		for(size_t p = 0; p < iov[i].iov_len;)
+		{
+			size_t sz = MIN(iov[i].iov_len - p, sizeof(buf) - len);
+			memcpy(&buf[len], (const uint8_t *)iov[i].iov_base + p, sz);
+			len += sz;
+			p += sz;
+			if(len < sizeof(buf)) continue;
+			int sts = sp_write(sp, buf, len);
+			if(sts) return *written ? 0 : sts;
+			*written += len;
+			len = 0;
+		}
+	}
+	if(len == 0) return 0;
+	int sts = sp_write(sp, buf, len);
+	if(sts) return *written ? 0 : sts;
+	*written += len;
+	return 0;
+}
+
 int sp_flush(sp_t *sp)
 {
 	if(WaitForSingleObject(sp->write_mutex, INFINITE) != WAIT_OBJECT_0) return SP_ERR_WR_LOCK;
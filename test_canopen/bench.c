@@ -0,0 +1,380 @@
+#include "bench.h"
+#include "co_wrapper.h"
+#include "sdo.h"
+#include "sdo_async.h"
+#include "sdo_sim.h"
+#include "slcan.h"
+#include "timedate.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/resource.h>
+#endif
+
+#define BENCH_NODE_BLK 10
+#define BENCH_NODE_SEG 11
+#define BENCH_TIMEOUT 1000
+
+static struct
+{
+	CO_t *co;
+	uint8_t node_blk, node_seg;
+	uint16_t seg_index, dom_index; // objects for the segmented latency and domain transfers
+	uint8_t seg_sub, dom_sub;
+	bool sim, dom;
+	uint32_t count;
+	size_t size;
+	int fails;
+} bench;
+
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+
+// user + system time of the process, the CANopen thread included
+static double cpu_us(void)
+{
+#if defined(_WIN32)
+	FILETIME c, e, k, u;
+	GetProcessTimes(GetCurrentProcess(), &c, &e, &k, &u);
+	return (double)(((uint64_t)k.dwHighDateTime << 32 | k.dwLowDateTime) + ((uint64_t)u.dwHighDateTime << 32 | u.dwLowDateTime)) / 10.0;
+#else
+	struct rusage ru;
+	getrusage(RUSAGE_SELF, &ru);
+	return (ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1e6 + ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+#endif
+}
+
+static uint64_t now_us(void)
+{
+	TD_V t;
+	TD_GET(t);
+	return (uint64_t)t.tv_sec * USEC_PER_SEC + (uint64_t)t.tv_nsec / NSEC_PER_USEC;
+}
+
+static int cmp_u32(const void *a, const void *b)
+{
+	const uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+	return x < y ? -1 : x > y;
+}
+
+// "index:sub", both C constants
+static bool parse_obj(const char *v, uint16_t *index, uint8_t *sub)
+{
+	char *end;
+	const unsigned long i = strtoul(v, &end, 0);
+	if(end == v || *end != ':' || i > 0xFFFF) return false;
+	const char *p = end + 1;
+	const unsigned long s = strtoul(p, &end, 0);
+	if(end == p || *end || s > 0xFF) return false;
+	*index = (uint16_t)i;
+	*sub = (uint8_t)s;
+	return true;
+}
+
+static void print_abort(const char *name, CO_SDO_abortCode_t sts)
+{
+	printf("%-24s FAIL (abort 0x%08X)\n", name, sts);
+	bench.fails++;
+}
+
+// Round trip latency of count uploads: percentiles and a log2 histogram
+// read_SDO() picks block or segmented from the object size seen by the warm up
+static void bench_latency(const char *name, uint8_t node, uint16_t index, uint8_t sub, size_t buf_size)
+{
+	uint32_t *lat = malloc(bench.count * sizeof(*lat));
+	if(!lat) return;
+	uint8_t data[256];
+	size_t rs;
+	uint32_t n = 0;
+	CO_SDO_abortCode_t sts = CO_SDO_AB_NONE;
+	for(int i = 0; i < 2 && !sts; i++) // warm up: learns the object size, then a block refusal
+		sts = read_SDO(bench.co->SDOclient, node, index, sub, data, buf_size, &rs, BENCH_TIMEOUT);
+	const double cpu0 = cpu_us();
+	for(; n < bench.count && !sts; n++)
+	{
+		const uint64_t t0 = now_us();
+		sts = read_SDO(bench.co->SDOclient, node, index, sub, data, buf_size, &rs, BENCH_TIMEOUT);
+		lat[n] = (uint32_t)(now_us() - t0);
+	}
+	const double cpu = cpu_us() - cpu0;
+	if(sts == CO_SDO_AB_NOT_EXIST && !bench.sim)
+	{
+		printf("%-24s skipped, no 0x%04X:%u on the node\n", name, index, sub);
+		free(lat);
+		return;
+	}
+	if(sts)
+	{
+		print_abort(name, sts);
+		free(lat);
+		return;
+	}
+
+	qsort(lat, n, sizeof(*lat), cmp_u32);
+	uint64_t sum = 0;
+	for(uint32_t i = 0; i < n; i++) sum += lat[i];
+#define PCT(p) lat[(size_t)((n - 1) * (p))]
+	printf("%-24s %u x 0x%04X:%u (%zu B)  cpu %.1f us/transfer\n", name, n, index, sub, rs, cpu / n);
+	printf("\tus: min %u  p50 %u  p90 %u  p99 %u  p999 %u  max %u  avg %.1f\n", lat[0], PCT(0.5), PCT(0.9), PCT(0.99), PCT(0.999), lat[n - 1], (double)sum / n);
+#undef PCT
+
+	uint32_t hist[32] = {0}, top = 0;
+	for(uint32_t i = 0; i < n; i++)
+	{
+		uint32_t bin = 0;
+		while(bin < 31 && (1u << bin) < lat[i]) bin++;
+		hist[bin]++;
+		if(hist[bin] > top) top = hist[bin];
+	}
+	for(uint32_t bin = 0; bin < 32; bin++)
+	{
+		if(!hist[bin]) continue;
+		printf("\t<= %8u us %7u ", 1u << bin, hist[bin]);
+		for(uint32_t i = 0; i < (hist[bin] * 50 + top - 1) / top; i++) putchar('#');
+		putchar('\n');
+	}
+	free(lat);
+}
+
+static void print_rate(const char *name, const char *dir, size_t bytes, uint32_t transfers, double s, double cpu)
+{
+	printf("%-24s %-8s %9zu B  %8.1f ms  %9.1f kB/s  %8.1f transfers/s  cpu %.1f us/transfer\n",
+		   name, dir, bytes, s * 1e3, bytes / s / 1e3, transfers / s, cpu / transfers);
+}
+
+// Expedited: count single-frame downloads and uploads of a 2 byte object
+static void bench_expedited(uint8_t node)
+{
+	uint16_t hb, v;
+	size_t rs;
+	CO_SDO_abortCode_t sts = read_SDO(bench.co->SDOclient, node, 0x1017, 0, (uint8_t *)&hb, sizeof(hb), &rs, BENCH_TIMEOUT);
+	if(sts)
+	{
+		print_abort("expedited", sts);
+		return;
+	}
+
+	TD_V t0, t1;
+	double cpu = cpu_us();
+	TD_GET(t0);
+	for(uint32_t i = 0; i < bench.count && !sts; i++)
+		sts = write_SDO(bench.co->SDOclient, node, 0x1017, 0, (uint8_t *)&hb, sizeof(hb), BENCH_TIMEOUT);
+	TD_GET(t1);
+	cpu = cpu_us() - cpu;
+	if(sts)
+	{
+		print_abort("expedited", sts);
+		return;
+	}
+	print_rate("expedited", "download", bench.count * sizeof(hb), bench.count, TD_CALC_s(t1, t0), cpu);
+
+	cpu = cpu_us();
+	TD_GET(t0);
+	for(uint32_t i = 0; i < bench.count && !sts; i++)
+		sts = read_SDO(bench.co->SDOclient, node, 0x1017, 0, (uint8_t *)&v, sizeof(v), &rs, BENCH_TIMEOUT);
+	TD_GET(t1);
+	cpu = cpu_us() - cpu;
+	if(sts || v != hb)
+	{
+		print_abort("expedited", sts);
+		return;
+	}
+	print_rate("expedited", "upload", bench.count * sizeof(hb), bench.count, TD_CALC_s(t1, t0), cpu);
+}
+
+// One domain download + upload of bench.size bytes, the node decides segmented or block
+static void bench_domain(const char *name, uint8_t node)
+{
+	uint8_t *wr = malloc(bench.size), *rd = malloc(bench.size);
+	if(!wr || !rd)
+	{
+		free(wr);
+		free(rd);
+		return;
+	}
+	for(size_t i = 0; i < bench.size; i++) wr[i] = (uint8_t)rand();
+
+	// a node refusing block transfer is learnt by the first request
+	size_t rs;
+	CO_SDO_abortCode_t sts = write_SDO(bench.co->SDOclient, node, bench.dom_index, bench.dom_sub, wr, CO_SDO_BLOCK_THRESHOLD + 1, BENCH_TIMEOUT);
+
+	TD_V t0, t1;
+	double cpu = cpu_us();
+	TD_GET(t0);
+	if(!sts) sts = write_SDO(bench.co->SDOclient, node, bench.dom_index, bench.dom_sub, wr, bench.size, BENCH_TIMEOUT);
+	TD_GET(t1);
+	cpu = cpu_us() - cpu;
+	if(sts)
+	{
+		print_abort(name, sts);
+		goto FIN;
+	}
+	print_rate(name, "download", bench.size, 1, TD_CALC_s(t1, t0), cpu);
+
+	cpu = cpu_us();
+	TD_GET(t0);
+	sts = read_SDO(bench.co->SDOclient, node, bench.dom_index, bench.dom_sub, rd, bench.size, &rs, BENCH_TIMEOUT);
+	TD_GET(t1);
+	cpu = cpu_us() - cpu;
+	if(sts || rs != bench.size || memcmp(rd, wr, bench.size))
+	{
+		if(!sts) printf("%-24s upload data mismatch\n", name);
+		print_abort(name, sts);
+		goto FIN;
+	}
+	print_rate(name, "upload", bench.size, 1, TD_CALC_s(t1, t0), cpu);
+
+FIN:
+	free(wr);
+	free(rd);
+}
+
+// Blocking and pooled clients on the same node, one after the other: SDOclient[0] keeps the node's COB-IDs after
+// read_SDO() and must not take the pool client's responses
+static void bench_interleave(uint8_t node)
+{
+	uint32_t a = 0, b = 0;
+	size_t rs;
+	co_sdo_req_t req;
+	for(uint32_t i = 0; i < 3; i++)
+	{
+		CO_SDO_abortCode_t sts = read_SDO(bench.co->SDOclient, node, 0x1000, 0, (uint8_t *)&a, sizeof(a), &rs, BENCH_TIMEOUT);
+		if(!sts && co_sdo_read(&bench.co->sdo_async, &req, node, 0x1000, 0, (uint8_t *)&b, sizeof(b), NULL, NULL))
+			sts = CO_SDO_AB_GENERAL;
+		else if(!sts)
+		{
+			while(!req.done)
+			{
+				SLEEP_MS(1);
+			}
+			sts = req.result;
+		}
+		if(sts || a != b)
+		{
+			print_abort("interleave", sts);
+			return;
+		}
+	}
+	printf("%-24s ok\n", "interleave");
+}
+
+int bench_main(int argc, char **argv)
+{
+	const char *port = NULL, *ifname = NULL;
+	uint32_t delay_us = 0;
+	int node = 0;
+	bench.count = 3000;
+	bench.size = 65536;
+	bench.seg_index = 0x1008;
+	bench.dom_index = 0x2000;
+	for(int i = 1; i < argc; i++)
+	{
+		const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+		if(!strcmp(argv[i], "-p") && v)
+			port = argv[++i];
+		else if(!strcmp(argv[i], "-i") && v)
+			ifname = argv[++i];
+		else if(!strcmp(argv[i], "-n") && v)
+			node = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "-c") && v)
+			bench.count = (uint32_t)atol(argv[++i]);
+		else if(!strcmp(argv[i], "-s") && v)
+			bench.size = (size_t)atol(argv[++i]);
+		else if(!strcmp(argv[i], "-d") && v)
+			delay_us = (uint32_t)atol(argv[++i]);
+		else if(!strcmp(argv[i], "-o") && v && parse_obj(argv[++i], &bench.seg_index, &bench.seg_sub))
+			continue;
+		else if(!strcmp(argv[i], "-D") && v && parse_obj(argv[++i], &bench.dom_index, &bench.dom_sub))
+			bench.dom = true;
+		else
+		{
+			printf("usage: %s [-p port | -i ifname] [-n node] [-c count] [-s size] [-d delay_us] [-o index:sub] [-D index:sub]\n", argv[0]);
+			return 1;
+		}
+	}
+	if(bench.count == 0) bench.count = 1;
+
+	sp_t sp = {0};
+#if defined(__linux__)
+	socketcan_t can = SOCKETCAN_INIT;
+	char port_name[sizeof(sp.port_name)];
+	pid_t sim = -1;
+	if(!port && !ifname)
+	{
+		if(bench.size == 0 || bench.size > SDO_SIM_DOMAIN_MAX) bench.size = SDO_SIM_DOMAIN_MAX;
+		// before the CANopen thread exists: fork() copies only the calling thread
+		const sdo_sim_cfg_t cfg = {.node_blk = BENCH_NODE_BLK, .node_seg = BENCH_NODE_SEG, .delay_us = delay_us};
+		sim = sdo_sim_start(&cfg, port_name, sizeof(port_name));
+		if(sim < 0)
+		{
+			printf("stand-in slave failed\n");
+			return 1;
+		}
+		port = port_name;
+		bench.sim = true;
+	}
+#else
+	(void)delay_us;
+	if(ifname)
+	{
+		printf("no SocketCAN on this platform, use -p port\n");
+		return 1;
+	}
+	if(!port)
+	{
+		printf("no stand-in slave on this platform, use -p port\n");
+		return 1;
+	}
+#endif
+	bench.node_blk = bench.node_seg = (uint8_t)(node ? node : bench.sim ? BENCH_NODE_BLK : 127);
+	if(bench.sim && !node) bench.node_seg = BENCH_NODE_SEG;
+
+	int sts;
+#if defined(__linux__)
+	if(ifname)
+	{
+		port = ifname;
+		sts = co_wrapper_init_socketcan(&bench.co, &can, NULL);
+		if(!sts) sts = socketcan_open(&can, ifname, bench.co->CANmodule);
+	}
+	else
+#endif
+	{
+		sts = co_wrapper_init(&bench.co, &sp, NULL);
+		if(!sts) sts = sp_open(&sp, port, sp_rx, bench.co);
+		if(!sts && !bench.sim) sts = sp_write(&sp, "Z0\r", 3); // no timestamps from the adapter
+	}
+	if(sts)
+	{
+		printf("init failed: %d\n", sts);
+		bench.fails++;
+		goto FIN;
+	}
+
+	printf("port %s%s, node %u/%u, %u transfers, domain %zu B, client blksize %d\n", port, bench.sim ? " (stand-in slave)" : "", bench.node_blk, bench.node_seg, bench.count, bench.size, CO_CONFIG_SDO_CLI_BLKSIZE);
+	bench_latency("latency expedited", bench.node_blk, 0x1000, 0, 4);
+	bench_latency("latency segmented", bench.node_seg, bench.seg_index, bench.seg_sub, 256);
+	bench_expedited(bench.node_blk);
+	bench_interleave(bench.node_blk);
+	if(bench.sim || bench.dom) // a real node has no known domain object to write
+	{
+		bench_domain("segmented", bench.node_seg);
+		bench_domain("block", bench.node_blk);
+	}
+
+FIN:
+	sp_close(&sp);
+#if defined(__linux__)
+	socketcan_close(&can);
+#endif
+	co_wrapper_deinit(&bench.co);
+#if defined(__linux__)
+	if(bench.sim) sdo_sim_stop(sim);
+#endif
+	printf("%s\n", bench.fails ? "FAILED" : "done");
+	return bench.fails ? 1 : 0;
+}
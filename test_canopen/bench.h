@@ -0,0 +1,17 @@
+#ifndef BENCH_H__
+#define BENCH_H__
+
+/**
+ * @brief SDO benchmark: round trip latency percentiles, expedited/segmented/block throughput and CPU time per transfer,
+ *	read_SDO() and the async pool interleaved on one node
+ * usage: bench [-p port | -i ifname] [-n node] [-c count] [-s size] [-d delay_us] [-o index:sub] [-D index:sub]
+ * 	without -p the SDO server is the stand-in slave from sdo_sim.h on a pty (Linux), so results do not depend on an adapter
+ * 	-i: SocketCAN interface instead of an SLCAN port, e.g. vcan0 with canopen_sim -i vcan0 on it
+ * 	-o: object for the segmented latency (0x1008:0), skipped when a -p node doesn't have it
+ * 	-D: domain object for the throughput transfers (0x2000:0), with -p they run only when it is given
+ *
+ * @return int 0 if every transfer succeeded
+ */
+int bench_main(int argc, char **argv);
+
+#endif // BENCH_H__
@@ -1,3 +1,4 @@
+#include "bench.h"
 #include "co_wrapper.h"
 #include "sdo.h"
 #include "slcan.h"
@@ -14,7 +15,12 @@ TS_V tstart, tdiff, tnow;
 
 static void cb_co_nmt_change(uint8_t node_id, uint8_t idx, CO_NMT_internalState_t NMTstate, void *priv) { printf("nmt change %d: => %d\n", node_id, NMTstate); }
 static void cb_co_hb_started(uint8_t node_id, uint8_t idx, void *priv) { printf("hb_started %d\n", node_id); }
-static void cb_co_hb_to(uint8_t node_id, uint8_t idx, void *priv) { printf("hb to %d: %d\n", node_id, OD_PERSIST_COMM.x1016_consumerHeartbeatTime[idx] & 0xFFFF); }
+static void cb_co_hb_to(uint8_t node_id, uint8_t idx, void *priv)
+{
+	uint16_t ms;
+	if(co_wrapper_hb_cons_ms(priv, idx, &ms)) printf("hb to %d: %d\n", node_id, ms);
+	else printf("hb to %d\n", node_id);
+}
 static void cb_co_hb_rst(uint8_t node_id, uint8_t idx, void *priv) { printf("hb rst %d\n", node_id); }
 
 void cb_co_frame_rx(void *priv, can_msg_t *msg)
@@ -39,13 +45,15 @@ void cb_co_frame_tx(void *priv, can_msg_t *msg)
 	putchar('\n');
 }
 
-static void sp_rx(sp_t *sp, const uint8_t *data, size_t len) { slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
+static size_t sp_rx(sp_t *sp, const uint8_t *data, size_t len) { return slcan_parse(((CO_t *)sp->priv)->CANmodule, data, len); }
 
 #define CHK(x) \
 	if((sts = x) != 0) printf("ERR %s: %s\n", #x, sp_err2_str(sts))
 
-int main(void)
+int main(int argc, char **argv)
 {
+	if(argc > 1 && !strcmp(argv[1], "bench")) return bench_main(argc - 1, argv + 1);
+
 	TS_GET(tstart);
 
 	CO_t *co;
@@ -65,7 +73,7 @@ int main(void)
 			break;
 		}
 
-	CHK(co_wrapper_init(&co, &sp));
+	CHK(co_wrapper_init(&co, &sp, NULL));
 	if(sts) goto FIN;
 
 	for(uint32_t i = 0; i < 127; i++)
@@ -29,12 +29,12 @@ const uint16_t product_id = 0x1337;
 	{                                     \
 		struct timespec ts;               \
 		ts.tv_sec = msecs / 1000;         \
-		ts.tv_nsec = msecs % 1000 * 1000; \
+		ts.tv_nsec = msecs % 1000 * 1000000L; \
 		nanosleep(&ts, NULL);             \
 	} while(0)
 #endif
 
-void rx(sp_t *sp, const uint8_t *data, size_t len)
+size_t rx(sp_t *sp, const uint8_t *data, size_t len)
 {
 	printf("\t%zu", len);
 	for(uint32_t i = 0; i < len; i++)
@@ -42,6 +42,7 @@ void rx(sp_t *sp, const uint8_t *data, size_t len)
 		put_ascii(data[i]);
 	}
 	putchar('\n');
+	return len;
 }
 
 #define CHK(x) \
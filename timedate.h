@@ -38,13 +38,13 @@ typedef struct timeval TS_V;
 #define SLEEP_MS(msecs) Sleep(msecs)
 #else
 #include <time.h>
-#define SLEEP_MS(msecs)                                                            \
-	struct timespec ts = {.tv_sec = msecs / 1000, .tv_nsec = msecs % 1000 * 1000}; \
-	int res;                                                                       \
-	do                                                                             \
-	{                                                                              \
-		errno = 0;                                                                 \
-		res = nanosleep(&ts, NULL);                                                \
+#define SLEEP_MS(msecs)                                                               \
+	struct timespec ts = {.tv_sec = msecs / 1000, .tv_nsec = msecs % 1000 * 1000000L}; \
+	int res;                                                                          \
+	do                                                                                \
+	{                                                                                 \
+		errno = 0;                                                                    \
+		res = nanosleep(&ts, NULL);                                                   \
 	} while(res != 0 && errno == EINTR)
 #endif
 